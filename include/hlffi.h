@@ -90,6 +90,9 @@ typedef struct hl_type hl_type;
  * - Values from hlffi_value_int/float/bool/string() are NOT rooted (temporary)
  * - Values from hlffi_get_field/hlffi_call_method() are NOT rooted (temporary)
  * - Strings from hlffi_value_as_string() must be freed with free()
+ * - For many long-lived references, prefer hlffi_handle (one root for all)
+ * - Inside hlffi_scope_begin/end, values are arena-allocated and released
+ *   together by hlffi_scope_end() (see "Value scopes")
  *
  * GC SAFETY:
  * Non-rooted values rely on GC stack scanning for protection. They are safe
@@ -141,6 +144,7 @@ typedef enum {
     HLFFI_ERROR_THREAD_START_FAILED,
     HLFFI_ERROR_THREAD_STOP_FAILED,
     HLFFI_ERROR_WRONG_THREAD,
+    HLFFI_ERROR_QUEUE_FULL,
 
     /* Event loop errors */
     HLFFI_ERROR_EVENTLOOP_NOT_FOUND,
@@ -217,12 +221,22 @@ typedef void (*hlffi_reload_callback)(hlffi_vm* vm, bool success, void* userdata
  */
 typedef void (*hlffi_thread_func)(hlffi_vm* vm, void* userdata);
 
+/**
+ * Thread function callback returning a result.
+ * Used with hlffi_thread_call_sync_result() and hlffi_thread_call_async_result().
+ *
+ * @param vm VM instance (safe to call hlffi_* functions)
+ * @param userdata User-provided data
+ * @return Result handed to the caller / async callback
+ */
+typedef void* (*hlffi_thread_result_func)(hlffi_vm* vm, void* userdata);
+
 /**
  * Thread async callback.
  * Called when async thread operation completes.
  *
  * @param vm VM instance
- * @param result Result from thread function (or NULL)
+ * @param result Result from an hlffi_thread_result_func (NULL for hlffi_thread_func)
  * @param userdata User-provided data
  */
 typedef void (*hlffi_thread_async_callback)(hlffi_vm* vm, void* result, void* userdata);
@@ -502,6 +516,8 @@ bool hlffi_thread_is_running(hlffi_vm* vm);
  * @param func Function to call in VM thread
  * @param userdata User data passed to function
  * @return HLFFI_OK on success, error code on failure
+ *         (HLFFI_ERROR_THREAD_NOT_STARTED if the thread stopped before
+ *         the call ran)
  *
  * @note Only use in THREADED mode
  * @note Blocks until function completes
@@ -509,6 +525,44 @@ bool hlffi_thread_is_running(hlffi_vm* vm);
  */
 hlffi_error_code hlffi_thread_call_sync(hlffi_vm* vm, hlffi_thread_func func, void* userdata);
 
+/**
+ * Call function in VM thread (synchronous) and return its result.
+ *
+ * Each sync caller waits on its own completion, so concurrent callers are
+ * woken independently of each other.
+ *
+ * @param vm       VM instance
+ * @param func     Function to call in VM thread
+ * @param userdata User data passed to function
+ * @param result   Receives the function's return value (can be NULL)
+ * @return HLFFI_OK on success, error code on failure (*result set to NULL);
+ *         HLFFI_ERROR_THREAD_NOT_STARTED if the thread stopped before the
+ *         call ran
+ *
+ * @note Only use in THREADED mode
+ * @note Blocks until function completes
+ * @note Thread-safe
+ *
+ * Example:
+ * @code
+ * static void* get_score(hlffi_vm* vm, void* userdata) {
+ *     hlffi_value* v = hlffi_call_static(vm, "Game", "getScore", 0, NULL);
+ *     intptr_t score = hlffi_value_as_int(v, 0);
+ *     hlffi_value_free(v);
+ *     return (void*)score;
+ * }
+ *
+ * void* score;
+ * hlffi_thread_call_sync_result(vm, get_score, NULL, &score);
+ * @endcode
+ */
+hlffi_error_code hlffi_thread_call_sync_result(
+    hlffi_vm* vm,
+    hlffi_thread_result_func func,
+    void* userdata,
+    void** result
+);
+
 /**
  * Call function in VM thread (asynchronous).
  * Queues a function call to the VM thread and returns immediately.
@@ -520,7 +574,7 @@ hlffi_error_code hlffi_thread_call_sync(hlffi_vm* vm, hlffi_thread_func func, vo
  * @return HLFFI_OK on success, error code on failure
  *
  * @note Only use in THREADED mode
- * @note Returns immediately
+ * @note Returns immediately (lock-free enqueue)
  * @note Thread-safe
  */
 hlffi_error_code hlffi_thread_call_async(
@@ -530,6 +584,73 @@ hlffi_error_code hlffi_thread_call_async(
     void* userdata
 );
 
+/**
+ * Call function in VM thread (asynchronous), passing its result to the callback.
+ *
+ * @param vm       VM instance
+ * @param func     Function to call in VM thread
+ * @param callback Receives func's return value on the VM thread (optional)
+ * @param userdata User data passed to function and callback
+ * @return HLFFI_OK on success, error code on failure
+ *
+ * @note Only use in THREADED mode
+ * @note Returns immediately (lock-free enqueue)
+ * @note Thread-safe
+ */
+hlffi_error_code hlffi_thread_call_async_result(
+    hlffi_vm* vm,
+    hlffi_thread_result_func func,
+    hlffi_thread_async_callback callback,
+    void* userdata
+);
+
+/**
+ * One entry of a batched VM thread call.
+ */
+typedef struct hlffi_thread_call {
+    hlffi_thread_result_func func;  /**< Function to run on the VM thread */
+    void* userdata;                 /**< Passed to func */
+    void* result;                   /**< Out: func's return value */
+} hlffi_thread_call;
+
+/**
+ * Run N functions in the VM thread with a single enqueue and a single wait.
+ *
+ * The whole batch is queued as one message and executed in order; the
+ * caller is woken once when the last entry has finished. Use instead of N
+ * hlffi_thread_call_sync() calls to avoid N round trips / context switches.
+ *
+ * @param vm    VM instance
+ * @param calls Array of entries (results written back into it)
+ * @param count Number of entries (0 returns immediately)
+ * @return HLFFI_OK on success, error code on failure
+ *         (HLFFI_ERROR_THREAD_NOT_STARTED if the thread stopped before the
+ *         batch ran - no entry was executed)
+ *
+ * @note Only use in THREADED mode
+ * @note Blocks until every entry has run
+ * @note Thread-safe
+ *
+ * @see hlffi_thread_call_cached_batch() for batches of typed cached calls
+ */
+hlffi_error_code hlffi_thread_call_batch(hlffi_vm* vm, hlffi_thread_call* calls, int count);
+
+/**
+ * Limit the number of pending messages for the VM thread.
+ *
+ * The message queue is lock-free and unbounded by default. A limit adds
+ * backpressure: hlffi_thread_call_async() returns HLFFI_ERROR_QUEUE_FULL
+ * while `max_pending` messages are queued or executing.
+ *
+ * @param vm          VM instance
+ * @param max_pending Maximum pending messages, 0 = unbounded (default)
+ * @return HLFFI_OK on success, HLFFI_ERROR_INVALID_ARGUMENT if negative
+ *
+ * @note Can be called before or after hlffi_thread_start()
+ * @note Sync calls are never rejected (the caller waits anyway)
+ */
+hlffi_error_code hlffi_thread_set_queue_limit(hlffi_vm* vm, int max_pending);
+
 /* ========== EVENT LOOP INTEGRATION (Advanced) ========== */
 
 /**
@@ -557,6 +678,21 @@ bool hlffi_has_pending_events(hlffi_vm* vm, hlffi_eventloop_type type);
 
 /* ========== HOT RELOAD ========== */
 
+/**
+ * Phase timings of the last reload (see hlffi_get_reload_stats()).
+ * All times are wall-clock milliseconds.
+ */
+typedef struct hlffi_reload_stats {
+    double read_ms;      /**< Reading the .hl file (0 for hlffi_reload_module_memory) */
+    double parse_ms;     /**< hl_code_read */
+    double patch_ms;     /**< hl_module_patch + name index rebuild */
+    double callback_ms;  /**< Reload callback (0 until the callback returns) */
+    double stall_ms;     /**< Time the VM thread was blocked; excludes read/parse when async */
+    bool async;          /**< Read and parsed off-thread by hlffi_reload_module_async() */
+    bool changed;        /**< hl_module_patch found changed functions */
+    bool success;        /**< false if the file could not be read or parsed */
+} hlffi_reload_stats;
+
 /**
  * Enable/disable hot reload.
  * Allows reloading changed bytecode without restart.
@@ -590,6 +726,8 @@ bool hlffi_is_hot_reload_enabled(hlffi_vm* vm);
  * @note Hot reload must be enabled
  * @note Preserves runtime state
  * @note Triggers reload callback if set
+ * @note Cached method and field handles stay usable: they re-resolve lazily
+ *       on their next use, no re-caching needed
  */
 hlffi_error_code hlffi_reload_module(hlffi_vm* vm, const char* path);
 
@@ -617,11 +755,87 @@ void hlffi_set_reload_callback(hlffi_vm* vm, hlffi_reload_callback callback, voi
  * Check for file changes and reload if needed.
  * Call this periodically (e.g., each frame) to enable automatic hot reload.
  *
+ * The file loaded with hlffi_load_file() is watched from load time: with
+ * inotify on Linux (a watch on its directory, so replace-by-rename is
+ * seen), with stat() modification time + size elsewhere. Between checks
+ * (see hlffi_set_reload_timing()) the call only reads a monotonic clock, so
+ * calling it every frame costs no filesystem access. A change is reloaded
+ * once the file has been quiet for the debounce period, so a file still
+ * being written is not loaded half-way.
+ *
  * @param vm VM instance
  * @return true if reload occurred, false otherwise
  */
 bool hlffi_check_reload(hlffi_vm* vm);
 
+/**
+ * Tune hlffi_check_reload().
+ *
+ * @param vm          VM instance
+ * @param poll_ms     Minimum interval between watch checks (default 250);
+ *                    0 checks on every call - use with hlffi_get_reload_fd().
+ *                    Negative keeps the current value.
+ * @param debounce_ms Quiet time after the last write before reloading
+ *                    (default 100). Negative keeps the current value.
+ */
+void hlffi_set_reload_timing(hlffi_vm* vm, int poll_ms, int debounce_ms);
+
+/**
+ * Get the file watch descriptor for an event loop.
+ *
+ * The descriptor becomes readable when the watched file changes. Hosts with
+ * their own poll/epoll loop can set the poll interval to 0
+ * (hlffi_set_reload_timing(vm, 0, -1)), add this fd to their loop, and call
+ * hlffi_check_reload() when it is readable and again once the debounce
+ * period has passed.
+ *
+ * @param vm VM instance
+ * @return inotify descriptor (Linux, after hlffi_load_file() with hot reload
+ *         enabled), or -1 when changes are detected by stat() polling
+ */
+int hlffi_get_reload_fd(hlffi_vm* vm);
+
+/**
+ * Reload module from file without blocking the VM thread on parsing.
+ *
+ * Reading and parsing the bytecode run on a background thread; only the
+ * patch (and the reload callback) run on the VM thread, at a safe point:
+ * - NON_THREADED mode: the next hlffi_update() after parsing finishes
+ * - THREADED mode: the VM thread's message loop, between batches of calls
+ *
+ * @param vm VM instance
+ * @param path Path to new .hl file (NULL = file passed to hlffi_load_file())
+ * @return HLFFI_OK if the reload was started, error code otherwise
+ *
+ * @note Hot reload must be enabled
+ * @note Parse errors are reported through the reload callback (success =
+ *       false) and hlffi_get_error(), not by this return value
+ * @note Only one async reload at a time: returns HLFFI_ERROR_RELOAD_FAILED
+ *       while one is pending
+ * @note hlffi_destroy() waits for a pending parse and discards it
+ */
+hlffi_error_code hlffi_reload_module_async(hlffi_vm* vm, const char* path);
+
+/**
+ * Check if an async reload is still being parsed or waiting to be applied.
+ *
+ * @param vm VM instance
+ * @return true between hlffi_reload_module_async() and its callback
+ */
+bool hlffi_reload_pending(hlffi_vm* vm);
+
+/**
+ * Get phase timings of the last reload (sync or async).
+ *
+ * Can be called from the reload callback: read/parse/patch times are final
+ * there, callback_ms and stall_ms are filled in after the callback returns.
+ *
+ * @param vm VM instance
+ * @param out Receives the timings
+ * @return false if no reload has happened yet
+ */
+bool hlffi_get_reload_stats(hlffi_vm* vm, hlffi_reload_stats* out);
+
 /* ========== WORKER THREAD HELPERS ========== */
 
 /**
@@ -731,6 +945,7 @@ typedef void (*hlffi_type_callback)(hlffi_type* type, void* userdata);
  * @note For packaged types, use full name: "com.example.Player"
  * @note Check hlffi_get_error() if NULL is returned
  * @note Type handle valid until module unloaded
+ * @note O(1): names are indexed once at load time (and after hot reload)
  */
 hlffi_type* hlffi_find_type(hlffi_vm* vm, const char* name);
 
@@ -893,6 +1108,9 @@ hlffi_value* hlffi_value_bool(hlffi_vm* vm, bool value);
  * @param vm VM instance
  * @param str UTF-8 string (will be converted to UTF-16)
  * @return Boxed value handle, or NULL if string is NULL
+ *
+ * @note Allocates a new HashLink string on every call. For strings passed
+ *       repeatedly, see hlffi_string_intern().
  */
 hlffi_value* hlffi_value_string(hlffi_vm* vm, const char* str);
 
@@ -979,6 +1197,306 @@ char* hlffi_value_as_string(hlffi_value* value);
  */
 bool hlffi_value_is_null(hlffi_value* value);
 
+/* ---------- Caller-storage values (no malloc) ---------- */
+
+/**
+ * Caller-provided storage for one hlffi_value.
+ *
+ * Lets value wrappers live on the stack, in arrays or inside C structs
+ * instead of being malloc'd per value. The *_at() constructors fill the
+ * storage and return an ordinary hlffi_value* usable with every API that
+ * takes values.
+ *
+ * @warning Never pass a storage-backed value to hlffi_value_free() - use
+ *          hlffi_value_release() instead
+ * @note Boxed primitives/strings are still GC-allocated; only the C-side
+ *       wrapper allocation is removed
+ *
+ * Example:
+ * @code
+ * hlffi_value_storage slots[3];
+ * hlffi_value* args[2] = {
+ *     hlffi_value_int_at(vm, &slots[0], 10),
+ *     hlffi_value_int_at(vm, &slots[1], 20)
+ * };
+ * hlffi_value* sum = hlffi_value_init(&slots[2]);
+ * if (hlffi_call_cached_into(add, 2, args, sum)) {
+ *     printf("%d\n", hlffi_value_as_int(sum, 0));
+ * }
+ * @endcode
+ */
+typedef struct hlffi_value_storage {
+    void* opaque[2];
+} hlffi_value_storage;
+
+/**
+ * Initialize storage as a null, unrooted value.
+ *
+ * @param storage Caller-provided storage
+ * @return Value view of the storage (same address), or NULL if storage is NULL
+ *
+ * @note Use as the output slot of hlffi_call_cached_into()
+ */
+hlffi_value* hlffi_value_init(hlffi_value_storage* storage);
+
+/**
+ * Create integer value in caller storage.
+ *
+ * @param vm      VM instance
+ * @param storage Caller-provided storage
+ * @param value   Integer value
+ * @return Value view of the storage, or NULL on invalid arguments
+ */
+hlffi_value* hlffi_value_int_at(hlffi_vm* vm, hlffi_value_storage* storage, int value);
+
+/**
+ * Create float value (F64) in caller storage.
+ *
+ * @param vm      VM instance
+ * @param storage Caller-provided storage
+ * @param value   Float value (64-bit double)
+ * @return Value view of the storage, or NULL on invalid arguments
+ */
+hlffi_value* hlffi_value_float_at(hlffi_vm* vm, hlffi_value_storage* storage, double value);
+
+/**
+ * Create boolean value in caller storage.
+ *
+ * @param vm      VM instance
+ * @param storage Caller-provided storage
+ * @param value   Boolean value
+ * @return Value view of the storage, or NULL on invalid arguments
+ */
+hlffi_value* hlffi_value_bool_at(hlffi_vm* vm, hlffi_value_storage* storage, bool value);
+
+/**
+ * Create string value in caller storage.
+ *
+ * @param vm      VM instance
+ * @param storage Caller-provided storage
+ * @param str     UTF-8 string (will be converted to UTF-16), NULL gives null
+ * @return Value view of the storage, or NULL on invalid arguments
+ */
+hlffi_value* hlffi_value_string_at(hlffi_vm* vm, hlffi_value_storage* storage, const char* str);
+
+/**
+ * Release a value without freeing its wrapper.
+ *
+ * Removes the GC root (if any) and resets the value to null. Use for
+ * storage-backed values; the storage can be reused afterwards.
+ *
+ * @param value Value to release (can be NULL)
+ */
+void hlffi_value_release(hlffi_value* value);
+
+/* ---------- Value scopes ---------- */
+
+/**
+ * Scope mark for hlffi_scope_begin/hlffi_scope_end.
+ *
+ * Declare on the stack; contents are private.
+ */
+typedef struct hlffi_scope {
+    void* opaque[3];
+} hlffi_scope;
+
+/**
+ * Open a value scope.
+ *
+ * Until the matching hlffi_scope_end(), every hlffi_value the library
+ * returns on this thread for this VM (constructors, hlffi_new, calls,
+ * field reads, array/map/enum accessors) is bump-allocated from a per-VM
+ * arena instead of malloc'd, and held by the arena instead of a per-value
+ * GC root. hlffi_scope_end() releases them all at once.
+ *
+ * Scopes nest; each end releases only the values allocated since its begin.
+ *
+ * @param vm    VM instance
+ * @param scope Caller-owned mark (usually a local variable)
+ * @return true on success, false on error
+ *
+ * @note hlffi_value_free() is a no-op on scope values, so existing code that
+ *       frees its temporaries keeps working inside a scope.
+ * @note Scope values are invalid after hlffi_scope_end() - copy out native
+ *       data (or create the value outside any scope) if it must live longer.
+ * @note Storage-backed values (hlffi_value_init) are never scope values.
+ * @note Other threads keep getting ordinary values for this VM, and fail to
+ *       open a scope on it until the owning thread has closed its scopes.
+ *
+ * @code
+ * hlffi_scope scope;
+ * hlffi_scope_begin(vm, &scope);
+ * for (int i = 0; i < count; i++) {
+ *     hlffi_value* e = hlffi_new(vm, "Enemy", 0, NULL);
+ *     hlffi_value* hp = hlffi_value_int(vm, 100);
+ *     hlffi_set_field(e, "health", hp);
+ *     hlffi_call_static(vm, "World", "spawn", 1, &e);
+ * }
+ * hlffi_scope_end(vm, &scope);  // Releases every wrapper above
+ * @endcode
+ */
+bool hlffi_scope_begin(hlffi_vm* vm, hlffi_scope* scope);
+
+/**
+ * Close a value scope opened by hlffi_scope_begin().
+ *
+ * Invalidates every value allocated since the matching begin. Scopes must be
+ * ended in reverse order of opening.
+ *
+ * @param vm    VM instance
+ * @param scope Mark passed to hlffi_scope_begin()
+ */
+void hlffi_scope_end(hlffi_vm* vm, hlffi_scope* scope);
+
+/* ---------- Handles ---------- */
+
+/**
+ * Generational handle to a Haxe value, for long-lived references from C.
+ *
+ * A handle is a 32-bit index into a per-VM table whose objects live in one
+ * GC-rooted array, so holding 100k references costs one GC root instead of
+ * 100k. Acquire and release are O(1) (free list). Each slot carries a
+ * generation that changes on release, so a stale handle (released, or whose
+ * slot was reused) is detected instead of aliasing the new occupant.
+ *
+ * Use the value APIs through a view: hlffi_handle_get() / hlffi_handle_get_at().
+ *
+ * @note Handles are VM-thread only, like the rest of the value API.
+ * @note At most 1M (2^20) live handles; a slot's generation wraps after 4095
+ *       reuses.
+ */
+typedef uint32_t hlffi_handle;
+
+/** Never a valid handle */
+#define HLFFI_HANDLE_NULL 0
+
+/**
+ * Store a value in the handle table.
+ *
+ * The table keeps the referenced object alive until hlffi_handle_release();
+ * the value passed in can be freed right away.
+ *
+ * @param vm    VM instance
+ * @param value Value to reference (a null value is allowed)
+ * @return New handle, or HLFFI_HANDLE_NULL on error
+ *
+ * @code
+ * hlffi_value* obj = hlffi_new(vm, "Enemy", 0, NULL);
+ * entity->script = hlffi_handle_acquire(vm, obj);
+ * hlffi_value_free(obj);  // The handle holds the object now
+ * @endcode
+ */
+hlffi_handle hlffi_handle_acquire(hlffi_vm* vm, hlffi_value* value);
+
+/**
+ * Release a handle and drop its reference.
+ *
+ * @param vm     VM instance
+ * @param handle Handle to release
+ * @return true on success, false if the handle is null or stale
+ */
+bool hlffi_handle_release(hlffi_vm* vm, hlffi_handle handle);
+
+/**
+ * Check whether a handle is live.
+ *
+ * @param vm     VM instance
+ * @param handle Handle to check
+ * @return true if the handle was acquired and not released since
+ */
+bool hlffi_handle_is_valid(hlffi_vm* vm, hlffi_handle handle);
+
+/**
+ * Get a value view of a handle, usable with every hlffi_value API.
+ *
+ * The view is not rooted (the table keeps the object alive) and follows the
+ * usual wrapper rules: free with hlffi_value_free(), or let an enclosing
+ * scope release it.
+ *
+ * @param vm     VM instance
+ * @param handle Live handle
+ * @return Value, or NULL if the handle is null or stale
+ *
+ * @code
+ * hlffi_value* enemy = hlffi_handle_get(vm, entity->script);
+ * hlffi_call_method(enemy, "update", 1, &dt);
+ * hlffi_value_free(enemy);
+ * @endcode
+ */
+hlffi_value* hlffi_handle_get(hlffi_vm* vm, hlffi_handle handle);
+
+/**
+ * Same as hlffi_handle_get() into caller storage (no allocation).
+ *
+ * @param vm      VM instance
+ * @param handle  Live handle
+ * @param storage Caller-provided storage
+ * @return Value view of the storage, or NULL if the handle is null or stale
+ */
+hlffi_value* hlffi_handle_get_at(hlffi_vm* vm, hlffi_handle handle, hlffi_value_storage* storage);
+
+/**
+ * Replace the value a handle references, keeping the handle.
+ *
+ * @param vm     VM instance
+ * @param handle Live handle
+ * @param value  New value
+ * @return true on success, false if the handle is null or stale
+ */
+bool hlffi_handle_set(hlffi_vm* vm, hlffi_handle handle, hlffi_value* value);
+
+/**
+ * Number of live handles.
+ *
+ * @param vm VM instance
+ * @return Live handle count
+ */
+int hlffi_handle_count(hlffi_vm* vm);
+
+/* ---------- Interned strings ---------- */
+
+/**
+ * Get the interned Haxe String for a C string.
+ *
+ * The first call for a given string converts it once and stores the
+ * resulting String in a per-VM table (GC-rooted); later calls with equal
+ * contents return the same value after one hash and compare, with no
+ * allocation. Use for event names, map keys and other strings passed
+ * repeatedly.
+ *
+ * The value is a real String object, so hlffi_call_static and cached calls
+ * pass it without retagging.
+ *
+ * @param vm  VM instance
+ * @param str UTF-8 string (compared by contents)
+ * @return VM-owned value, valid until hlffi_string_intern_clear() or
+ *         hlffi_destroy(); NULL on error
+ *
+ * @note Do NOT call hlffi_value_free() or hlffi_value_release() on the result.
+ * @note Interned values are shared: mutating them (e.g. storing into them
+ *       through reflection) affects every user. Strings are immutable in Haxe.
+ *
+ * @code
+ * // Once, at startup
+ * hlffi_value* ev_hit = hlffi_string_intern(vm, "hit");
+ *
+ * // Every frame, no string allocation
+ * hlffi_value* args[] = {ev_hit, damage};
+ * hlffi_call_cached(on_event, 2, args);
+ * @endcode
+ */
+hlffi_value* hlffi_string_intern(hlffi_vm* vm, const char* str);
+
+/**
+ * Release all interned strings.
+ *
+ * Every value previously returned by hlffi_string_intern() becomes invalid.
+ * Called automatically by hlffi_destroy().
+ *
+ * @param vm VM instance
+ */
+void hlffi_string_intern_clear(hlffi_vm* vm);
+
 /* ========== PHASE 5: ARRAY OPERATIONS ========== */
 
 /**
@@ -1043,13 +1561,17 @@ bool hlffi_array_set(hlffi_vm* vm, hlffi_value* arr, int index, hlffi_value* val
 /**
  * Append element to end of array.
  *
+ * Appends in place into spare capacity of the Array's backing store and
+ * grows it geometrically (x1.5, like Haxe's own push) when full, so building
+ * an N-element array costs amortized O(1) per push.
+ *
  * @param vm VM instance
- * @param arr Array value (will be modified to point to new larger array)
+ * @param arr Array value
  * @param value Value to append
  * @return true on success, false on error
  *
- * @warning This creates a new array and copies all elements! O(n) operation.
- *          For building large arrays, preallocate with hlffi_array_new() and use hlffi_array_set()
+ * @note A raw NativeArray (fixed size) is converted to a Haxe Array on the
+ *       first push; arr is updated to point to it
  *
  * Example:
  *   hlffi_value* val = hlffi_value_int(vm, 99);
@@ -1058,6 +1580,79 @@ bool hlffi_array_set(hlffi_vm* vm, hlffi_value* arr, int index, hlffi_value* val
  */
 bool hlffi_array_push(hlffi_vm* vm, hlffi_value* arr, hlffi_value* value);
 
+/**
+ * Append `count` elements from a C buffer in one call.
+ *
+ * Capacity is grown at most once, then numeric elements are copied with a
+ * single memcpy.
+ *
+ * @param vm    VM instance
+ * @param arr   Array value (NativeArrays are converted as in hlffi_array_push())
+ * @param data  Buffer in the element representation: int32_t for Array<Int>,
+ *              double for Array<Float>, float for Array<Single>, uint8_t
+ *              (0/1) for Array<Bool>, hlffi_value* for object arrays
+ * @param count Number of elements
+ * @return true on success, false on error
+ *
+ * Example:
+ *   double samples[256];
+ *   read_samples(samples, 256);
+ *   hlffi_array_push_n(vm, history, samples, 256);
+ */
+bool hlffi_array_push_n(hlffi_vm* vm, hlffi_value* arr, const void* data, int count);
+
+/* === Bulk Import/Export === */
+
+/**
+ * Copy a numeric array out into a caller buffer with one memcpy.
+ *
+ * Works on Array<Int>, Array<Single>, Array<Float>, Array<Bool> and on
+ * NativeArrays of those element types. No per-element calls, no allocation.
+ *
+ * @param vm        VM instance
+ * @param arr       Array value
+ * @param type      Buffer element type: HLFFI_TYPE_I32 (int32_t), HLFFI_TYPE_F32
+ *                  (float), HLFFI_TYPE_F64 (double) or HLFFI_TYPE_BOOL (bool);
+ *                  must match the array's element type
+ * @param out       Destination buffer, or NULL to query the length
+ * @param max_count Capacity of out in elements
+ * @return Elements copied (array length if out is NULL), or -1 on error
+ *
+ * Example:
+ * @code
+ * static double samples[MAX_SAMPLES];
+ * int n = hlffi_array_export(vm, telemetry, HLFFI_TYPE_F64, samples, MAX_SAMPLES);
+ * @endcode
+ */
+int hlffi_array_export(hlffi_vm* vm, hlffi_value* arr, hlffi_type_kind type, void* out, int max_count);
+
+/**
+ * Fill a numeric array from a C buffer with one memcpy.
+ *
+ * For Haxe Arrays the length becomes `count`; the existing backing store is
+ * reused when large enough, so refilling an array of the same size every
+ * tick does not allocate. NativeArrays are fixed size: the first `count`
+ * elements are overwritten (count must not exceed the size).
+ *
+ * @param vm    VM instance
+ * @param arr   Array value (element type must match `type`)
+ * @param type  Buffer element type (see hlffi_array_export())
+ * @param data  Source buffer
+ * @param count Number of elements
+ * @return true on success, false on error
+ *
+ * Example:
+ * @code
+ * hlffi_value* arr = hlffi_array_new(vm, &hlt_f64, 0);
+ * while (running) {
+ *     int n = read_telemetry(samples, MAX_SAMPLES);
+ *     hlffi_array_import(vm, arr, HLFFI_TYPE_F64, samples, n);
+ *     hlffi_value_free(hlffi_call_static(vm, "Telemetry", "process", 1, &arr));
+ * }
+ * @endcode
+ */
+bool hlffi_array_import(hlffi_vm* vm, hlffi_value* arr, hlffi_type_kind type, const void* data, int count);
+
 /* === NativeArray Support === */
 
 /**
@@ -1096,6 +1691,107 @@ hlffi_value* hlffi_native_array_new(hlffi_vm* vm, hl_type* element_type, int len
  */
 void* hlffi_native_array_get_ptr(hlffi_value* arr);
 
+/* === Typed Array Views (Zero-Copy) === */
+
+/**
+ * Pinned, typed view over the storage of a Haxe numeric array.
+ *
+ * `data` points directly at the Haxe-owned buffer: reads and writes through
+ * it are seen by Haxe code without any copy. Elements [length, capacity)
+ * are allocated but not part of the array.
+ *
+ * @note The view roots the array; it must stay at the same address while
+ *       pinned (like hlffi_value_storage)
+ */
+typedef struct hlffi_array_view {
+    union {
+        void* data;
+        int32_t* i32;           /**< Array<Int> */
+        float* f32;             /**< Array<Single> */
+        double* f64;            /**< Array<Float> */
+    };
+    int length;                 /**< Elements in use */
+    int capacity;               /**< Elements allocated */
+    hlffi_type_kind type;       /**< HLFFI_TYPE_I32, HLFFI_TYPE_F32 or HLFFI_TYPE_F64 */
+    void* opaque;               /**< Private: pinned array */
+} hlffi_array_view;
+
+/**
+ * Pin a typed view over Array<Int>, Array<Float> or Array<Single>.
+ *
+ * Also accepts NativeArrays of those element types (fixed size: reserve and
+ * resize beyond the current size fail).
+ *
+ * @param vm   VM instance
+ * @param arr  Array value
+ * @param view View to fill (zeroed on failure)
+ * @return true on success, false if arr is not a supported numeric array
+ *
+ * @note Release with hlffi_array_view_release()
+ * @warning Haxe code that grows the array (push, resize) may move its
+ *          buffer: call hlffi_array_view_refresh() after running Haxe code
+ *
+ * Example:
+ * @code
+ * hlffi_array_view v;
+ * if (hlffi_array_view_pin(vm, positions, &v)) {
+ *     for (int i = 0; i < v.length; i++) v.f64[i] += dt * speed;
+ *     hlffi_array_view_release(&v);
+ * }
+ * @endcode
+ */
+bool hlffi_array_view_pin(hlffi_vm* vm, hlffi_value* arr, hlffi_array_view* view);
+
+/**
+ * Re-read data, length and capacity from the pinned array.
+ *
+ * @param view Pinned view
+ * @return true on success
+ */
+bool hlffi_array_view_refresh(hlffi_array_view* view);
+
+/**
+ * Ensure capacity for at least `capacity` elements without changing length.
+ *
+ * Reallocates the buffer (once) if needed; `data` is updated and any
+ * previously read pointer is invalidated.
+ *
+ * @param vm       VM instance
+ * @param view     Pinned view
+ * @param capacity Minimum capacity in elements
+ * @return true on success
+ */
+bool hlffi_array_view_reserve(hlffi_vm* vm, hlffi_array_view* view, int capacity);
+
+/**
+ * Set the array length from C.
+ *
+ * Growing within capacity does not reallocate; growing beyond it reserves
+ * geometrically (x1.5) so repeated resizes amortize. New elements are zero.
+ *
+ * @param vm     VM instance
+ * @param view   Pinned view
+ * @param length New length
+ * @return true on success
+ *
+ * Example:
+ * @code
+ * hlffi_array_view_reserve(vm, &v, 4096);       // one allocation up front
+ * for (...) {
+ *     hlffi_array_view_resize(vm, &v, v.length + 1);   // no reallocation
+ *     v.i32[v.length - 1] = value;
+ * }
+ * @endcode
+ */
+bool hlffi_array_view_resize(hlffi_vm* vm, hlffi_array_view* view, int length);
+
+/**
+ * Unpin a view (removes the GC root). Safe on a zeroed or released view.
+ *
+ * @param view View to release
+ */
+void hlffi_array_view_release(hlffi_array_view* view);
+
 /* === Struct Array Support === */
 
 /**
@@ -1198,17 +1894,27 @@ void* hlffi_native_array_get_struct_ptr(hlffi_value* arr);
 
 /* === Map Support === */
 
+/*
+ * Map<Int,V>, Map<String,V> and Map<{object},V> (haxe.ds.IntMap, StringMap,
+ * ObjectMap) are accessed through HashLink's native hashtables directly:
+ * no method lookup or argument boxing per operation. Other map classes
+ * (e.g. EnumValueMap) fall back to reflective method calls.
+ */
+
 /**
  * Create a new Map.
  * Maps are HashLink's implementation of hash tables/dictionaries.
  *
  * @param vm VM instance
- * @param key_type Type of keys (&hlt_i32 for IntMap, &hlt_bytes for StringMap, &hlt_dyn for ObjectMap)
+ * @param key_type Type of keys (&hlt_i32 for IntMap, &hlt_bytes for StringMap, &hlt_dyn or NULL for ObjectMap)
  * @param value_type Type of values (use &hlt_dyn for mixed types)
- * @return New empty map, or NULL on error
+ * @return New empty map (GC-rooted, free with hlffi_value_free), or NULL on error
  *
  * @note Maps in Haxe: Map<Int,String>, Map<String,Int>, etc.
  * @note HashLink uses specialized map types per key type
+ * @note The map class must be compiled into the module (use that Map type
+ *       somewhere in Haxe), otherwise HLFFI_ERROR_TYPE_NOT_FOUND is reported.
+ * @note Values are stored as Dynamic; value_type is informational.
  *
  * Example:
  *   hlffi_value* map = hlffi_map_new(vm, &hlt_i32, &hlt_bytes); // Map<Int,String>
@@ -1240,9 +1946,9 @@ bool hlffi_map_set(hlffi_vm* vm, hlffi_value* map, hlffi_value* key, hlffi_value
  * @param vm VM instance
  * @param map Map value
  * @param key Key to lookup
- * @return Value associated with key, or NULL if not found
+ * @return Value associated with key (a null value if not found), or NULL on error
  *
- * @note Returns NULL if key doesn't exist (use hlffi_map_exists to distinguish from null values)
+ * @note A missing key gives a null value (use hlffi_map_exists to distinguish from null values)
  *
  * Example:
  *   hlffi_value* key = hlffi_value_int(vm, 42);
@@ -1333,7 +2039,9 @@ hlffi_value* hlffi_map_values(hlffi_vm* vm, hlffi_value* map);
  * Get the number of entries in the map.
  *
  * @param map Map value
- * @return Number of key-value pairs, or -1 on error
+ * @return Number of key-value pairs, or -1 if map is not a native-backed map
+ *
+ * @note O(1): the entry count is kept by the hashtable.
  *
  * Example:
  *   int size = hlffi_map_size(map);
@@ -1354,6 +2062,173 @@ int hlffi_map_size(hlffi_value* map);
  */
 bool hlffi_map_clear(hlffi_value* map);
 
+/* ---------- Map iteration and export ---------- */
+
+/**
+ * Callback for hlffi_map_foreach().
+ *
+ * @param key      Entry key (borrowed: valid only during the call, do not free)
+ * @param value    Entry value (borrowed: valid only during the call, do not free)
+ * @param userdata User pointer passed to hlffi_map_foreach()
+ * @return true to continue, false to stop iterating
+ *
+ * @note Int keys read with hlffi_value_as_int(), String keys with
+ *       hlffi_value_as_string(). To keep a value beyond the callback, copy
+ *       it out (e.g. hlffi_value_as_*).
+ */
+typedef bool (*hlffi_map_entry_fn)(hlffi_value* key, hlffi_value* value, void* userdata);
+
+/**
+ * Visit every entry of a map from C.
+ *
+ * Walks a snapshot of the native hashtable (two array allocations per call,
+ * none per entry) instead of Haxe key/value iterators. The map may be
+ * modified from the callback; the walk still sees the snapshot.
+ *
+ * @param vm       VM instance
+ * @param map      IntMap, StringMap or ObjectMap
+ * @param fn       Called once per entry
+ * @param userdata Passed to fn
+ * @return Number of entries visited, or -1 on error (e.g. not a native-backed map)
+ *
+ * @code
+ * static bool add_stock(hlffi_value* key, hlffi_value* value, void* total) {
+ *     *(long*)total += hlffi_value_as_int(value, 0);
+ *     return true;
+ * }
+ * long total = 0;
+ * hlffi_map_foreach(vm, inventory, add_stock, &total);
+ * @endcode
+ */
+int hlffi_map_foreach(hlffi_vm* vm, hlffi_value* map, hlffi_map_entry_fn fn, void* userdata);
+
+/**
+ * Copy map keys and/or values into C buffers in one pass.
+ *
+ * keys_out[i] and values_out[i] belong to the same entry.
+ *
+ * @param vm         VM instance
+ * @param map        IntMap, StringMap or ObjectMap
+ * @param key_type   HLFFI_TYPE_I32 (int32_t[], IntMap) or HLFFI_TYPE_BYTES
+ *                   (char*[] of malloc'd UTF-8 strings the caller frees, StringMap)
+ * @param keys_out   Key buffer, or NULL to skip keys
+ * @param value_type HLFFI_TYPE_I32 (int32_t), HLFFI_TYPE_F32 (float),
+ *                   HLFFI_TYPE_F64 (double) or HLFFI_TYPE_BOOL (bool);
+ *                   null or non-numeric values export as 0
+ * @param values_out Value buffer, or NULL to skip values
+ * @param cap        Capacity of the buffers in entries
+ * @return Entries copied (at most cap; map size if both buffers are NULL),
+ *         or -1 on error
+ *
+ * @code
+ * int n = hlffi_map_export(vm, inventory, HLFFI_TYPE_I32, NULL, HLFFI_TYPE_VOID, NULL, 0);
+ * int32_t* ids = malloc(n * sizeof(int32_t));
+ * int32_t* counts = malloc(n * sizeof(int32_t));
+ * n = hlffi_map_export(vm, inventory, HLFFI_TYPE_I32, ids, HLFFI_TYPE_I32, counts, n);
+ * @endcode
+ */
+int hlffi_map_export(hlffi_vm* vm, hlffi_value* map,
+                     hlffi_type_kind key_type, void* keys_out,
+                     hlffi_type_kind value_type, void* values_out, int cap);
+
+/**
+ * Insert n entries from C buffers in one call.
+ *
+ * Resolves the map and validates the buffer types once, then inserts
+ * straight into the native hashtable (no reflective map.set per entry).
+ * Existing keys are overwritten.
+ *
+ * @param vm         VM instance
+ * @param map        IntMap, StringMap or ObjectMap
+ * @param key_type   HLFFI_TYPE_I32 (const int32_t[], IntMap),
+ *                   HLFFI_TYPE_BYTES (const char*[] UTF-8, StringMap) or
+ *                   HLFFI_TYPE_DYN (hlffi_value*[], any native map)
+ * @param keys       Key buffer
+ * @param value_type HLFFI_TYPE_I32, F32, F64, BOOL (numeric buffer, boxed
+ *                   per entry) or HLFFI_TYPE_DYN (hlffi_value*[], NULL = null)
+ * @param values     Value buffer
+ * @param n          Number of entries
+ * @return true on success; on error, entries before the failing one stay inserted
+ *
+ * @note HashLink's hashtables have no reserve primitive, so the table still
+ *       grows geometrically while inserting (amortized O(1) per entry).
+ *
+ * @code
+ * static const char* names[] = {"sword", "shield", "potion"};
+ * static const int32_t prices[] = {150, 90, 25};
+ * hlffi_value* shop = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+ * hlffi_map_set_many(vm, shop, HLFFI_TYPE_BYTES, names, HLFFI_TYPE_I32, prices, 3);
+ * @endcode
+ */
+bool hlffi_map_set_many(hlffi_vm* vm, hlffi_value* map,
+                        hlffi_type_kind key_type, const void* keys,
+                        hlffi_type_kind value_type, const void* values, int n);
+
+/* ---------- Typed map access ---------- */
+
+/*
+ * Keys given as C values: hlffi_map_int_* for Map<Int,V>, hlffi_map_str_*
+ * for Map<String,V> (UTF-8 keys; lookups do not allocate from the GC).
+ * The *_int / *_float variants box and unbox the value in place.
+ * A map of the wrong kind reports HLFFI_ERROR_TYPE_MISMATCH.
+ *
+ * @code
+ * hlffi_map_str_set_int(vm, scores, "alice", 1000);
+ * int s = hlffi_map_str_get_int(vm, scores, "alice", 0);
+ *
+ * hlffi_map_int_set_float(vm, weights, 7, 0.25);
+ * if (hlffi_map_int_exists(vm, weights, 7)) { ... }
+ * @endcode
+ */
+
+/** Set map[key] = value on a Map<Int,V>. */
+bool hlffi_map_int_set(hlffi_vm* vm, hlffi_value* map, int key, hlffi_value* value);
+
+/** Get map[key] from a Map<Int,V> (null value if missing; free the result). */
+hlffi_value* hlffi_map_int_get(hlffi_vm* vm, hlffi_value* map, int key);
+
+/** Check whether a Map<Int,V> contains key. */
+bool hlffi_map_int_exists(hlffi_vm* vm, hlffi_value* map, int key);
+
+/** Remove key from a Map<Int,V>. @return true if it was present */
+bool hlffi_map_int_remove(hlffi_vm* vm, hlffi_value* map, int key);
+
+/** Set map[key] = value on a Map<Int,Int>. */
+bool hlffi_map_int_set_int(hlffi_vm* vm, hlffi_value* map, int key, int value);
+
+/** Get map[key] from a Map<Int,Int>, or fallback if missing/not an Int. */
+int hlffi_map_int_get_int(hlffi_vm* vm, hlffi_value* map, int key, int fallback);
+
+/** Set map[key] = value on a Map<Int,Float>. */
+bool hlffi_map_int_set_float(hlffi_vm* vm, hlffi_value* map, int key, double value);
+
+/** Get map[key] from a Map<Int,Float>, or fallback if missing/not a number. */
+double hlffi_map_int_get_float(hlffi_vm* vm, hlffi_value* map, int key, double fallback);
+
+/** Set map[key] = value on a Map<String,V>. */
+bool hlffi_map_str_set(hlffi_vm* vm, hlffi_value* map, const char* key, hlffi_value* value);
+
+/** Get map[key] from a Map<String,V> (null value if missing; free the result). */
+hlffi_value* hlffi_map_str_get(hlffi_vm* vm, hlffi_value* map, const char* key);
+
+/** Check whether a Map<String,V> contains key. */
+bool hlffi_map_str_exists(hlffi_vm* vm, hlffi_value* map, const char* key);
+
+/** Remove key from a Map<String,V>. @return true if it was present */
+bool hlffi_map_str_remove(hlffi_vm* vm, hlffi_value* map, const char* key);
+
+/** Set map[key] = value on a Map<String,Int>. */
+bool hlffi_map_str_set_int(hlffi_vm* vm, hlffi_value* map, const char* key, int value);
+
+/** Get map[key] from a Map<String,Int>, or fallback if missing/not an Int. */
+int hlffi_map_str_get_int(hlffi_vm* vm, hlffi_value* map, const char* key, int fallback);
+
+/** Set map[key] = value on a Map<String,Float>. */
+bool hlffi_map_str_set_float(hlffi_vm* vm, hlffi_value* map, const char* key, double value);
+
+/** Get map[key] from a Map<String,Float>, or fallback if missing/not a number. */
+double hlffi_map_str_get_float(hlffi_vm* vm, hlffi_value* map, const char* key, double fallback);
+
 /* ========== Phase 5: Bytes Operations ========== */
 
 /**
@@ -1980,24 +2855,19 @@ bool hlffi_is_instance_of(hlffi_value* obj, const char* class_name);
 /**
  * Callback argument/return type descriptors for typed callback registration.
  *
- * @warning EXPERIMENTAL - NOT RECOMMENDED FOR PRODUCTION USE
- *
- * Typed callbacks (hlffi_register_callback_typed) have a fundamental limitation:
- * The wrapper functions expect vdynamic* pointers for all arguments, but HashLink
- * passes primitive types (Int/Float/Bool) as raw values when using typed closures.
- * This causes crashes when invoking callbacks with primitive arguments.
+ * Typed callbacks (hlffi_register_callback_typed) are closures whose HashLink
+ * function type uses the real primitive types (i32/f64/bool), so Haxe calls them
+ * with raw Int/Float/Bool values instead of boxing each argument into a Dynamic.
+ * The C callback still uses the hlffi_native_func signature; primitive arguments
+ * arrive as stack-resident values read with hlffi_value_as_int/_float/_bool.
  *
- * For production use, always use hlffi_register_callback() with Dynamic types in Haxe:
- *
- * Example (WORKING):
+ * Example:
  *   // Haxe:
- *   public static var onMessage:Dynamic = null;  // Use Dynamic!
+ *   public static var onImpact:(Int, Float, Bool)->Float = null;
  *
  *   // C:
- *   hlffi_register_callback(vm, "onMessage", my_callback, 1);
- *
- * The typed API is provided for experimentation but requires significant refactoring
- * of wrapper functions to support primitive type signatures.
+ *   hlffi_arg_type args[] = {HLFFI_ARG_INT, HLFFI_ARG_FLOAT, HLFFI_ARG_BOOL};
+ *   hlffi_register_callback_typed(vm, "onImpact", on_impact, 3, args, HLFFI_ARG_FLOAT);
  */
 typedef enum {
     HLFFI_ARG_VOID = 0,     /**< Void (no return value) */
@@ -2008,13 +2878,22 @@ typedef enum {
     HLFFI_ARG_DYNAMIC       /**< Dynamic (any type) */
 } hlffi_arg_type;
 
+/** Maximum number of arguments of a registered callback */
+#define HLFFI_MAX_CALLBACK_ARGS 16
+
+/** Maximum number of arguments of a typed callback (hlffi_register_callback_typed) */
+#define HLFFI_MAX_TYPED_CALLBACK_ARGS 6
+
 /**
  * Native function signature for callbacks from Haxe.
  *
  * @param vm VM instance
  * @param argc Number of arguments
- * @param argv Array of argument values
- * @return Return value for Haxe (use hlffi_value_null for void)
+ * @param argv Array of argument values. Borrowed views that live on the
+ *             dispatcher's stack: valid only until the callback returns, never
+ *             free them (copy out with hlffi_value_as_* to keep a value)
+ * @return Return value for Haxe (use hlffi_value_null for void; NULL also
+ *         returns null to Haxe without allocating a wrapper)
  *
  * Example:
  *   hlffi_value* my_callback(hlffi_vm* vm, int argc, hlffi_value** argv) {
@@ -2034,9 +2913,13 @@ typedef hlffi_value* (*hlffi_native_func)(hlffi_vm* vm, int argc, hlffi_value**
  * @param vm VM instance
  * @param name Callback name for retrieval
  * @param func C function pointer
- * @param nargs Number of arguments the callback expects
+ * @param nargs Number of arguments the callback expects (0 to HLFFI_MAX_CALLBACK_ARGS)
  * @return true on success, false on error
  *
+ * @note Invocations from Haxe do no heap allocation for the arguments.
+ * @note There is no limit on the number of registered callbacks; registration,
+ *       hlffi_get_callback() and hlffi_unregister_callback() are hashed by name.
+ *
  * Example:
  *   // 1. Register C callback
  *   hlffi_register_callback(vm, "onEvent", my_callback, 1);
@@ -2054,38 +2937,35 @@ bool hlffi_register_callback(hlffi_vm* vm, const char* name, hlffi_native_func f
 /**
  * Register a typed C callback with specific argument and return types.
  *
- * @warning EXPERIMENTAL - DO NOT USE IN PRODUCTION
- *
- * This function has a critical limitation: wrapper functions expect vdynamic* for all
- * arguments, but typed closures pass primitives (Int/Float/Bool) as raw values, causing
- * crashes when callbacks with primitive args are invoked.
- *
- * CRASHES WHEN CALLED:
- *   - Callbacks with Int, Float, or Bool arguments
- *   - Works only for String arguments (which are vdynamic* pointers)
- *
- * USE hlffi_register_callback() with Dynamic types instead!
+ * The closure gets a HashLink function type built from arg_types/return_type,
+ * so it can be stored in a typed Haxe field (e.g. (Int, Float)->Float) and Haxe
+ * passes Int/Float/Bool in registers without boxing. In the C callback:
+ *   - HLFFI_ARG_INT/FLOAT/BOOL arguments are borrowed stack values; read them
+ *     with hlffi_value_as_int/_float/_bool (no heap allocation either side)
+ *   - HLFFI_ARG_STRING/DYNAMIC arguments are the Haxe objects themselves
+ *   - the returned hlffi_value* is converted to return_type (NULL gives
+ *     0 / 0.0 / false / null)
  *
  * @param vm VM instance
  * @param name Callback name for retrieval
  * @param func C function pointer
- * @param nargs Number of arguments
- * @param arg_types Array of argument type descriptors (length = nargs)
+ * @param nargs Number of arguments (0 to HLFFI_MAX_TYPED_CALLBACK_ARGS)
+ * @param arg_types Array of argument type descriptors (length = nargs, no HLFFI_ARG_VOID)
  * @param return_type Return type descriptor
  * @return true on success, false on error
  *
- * Example (DO NOT USE - shown for reference only):
- *   // This will CRASH when invoked from Haxe:
- *   hlffi_arg_type args[] = {HLFFI_ARG_INT, HLFFI_ARG_INT};
- *   hlffi_register_callback_typed(vm, "onAdd", callback, 2, args, HLFFI_ARG_INT);
+ * @note The Haxe field's type must match the registered signature exactly;
+ *       HashLink does not check it when the closure is assigned from C.
  *
- * Use this instead:
- *   hlffi_register_callback(vm, "onAdd", callback, 2);  // Works!
- *   // In Haxe: public static var onAdd:Dynamic = null;
+ * Example:
+ *   hlffi_value* on_add(hlffi_vm* vm, int argc, hlffi_value** argv) {
+ *       int sum = hlffi_value_as_int(argv[0], 0) + hlffi_value_as_int(argv[1], 0);
+ *       return hlffi_value_int(vm, sum);
+ *   }
  *
- * @note NEEDS IMPROVEMENT: To fix this, typed wrapper functions must be created
- *       for all type combinations, or a dynamic wrapper generation system using
- *       libffi or similar must be implemented. See TODO in src/hlffi_callbacks.c
+ *   hlffi_arg_type args[] = {HLFFI_ARG_INT, HLFFI_ARG_INT};
+ *   hlffi_register_callback_typed(vm, "onAdd", on_add, 2, args, HLFFI_ARG_INT);
+ *   // In Haxe: public static var onAdd:(Int, Int)->Int = null;
  */
 bool hlffi_register_callback_typed(
     hlffi_vm* vm,
@@ -2190,9 +3070,11 @@ hlffi_call_result hlffi_try_call_method(
  * Get the last exception message from the VM.
  *
  * @param vm VM instance
- * @return Exception message string (static buffer, do not free), or NULL
+ * @return Exception message string (VM buffer, do not free), or NULL
  *
- * @note Only valid immediately after a call that threw an exception
+ * @note Valid until the next exception or hlffi_clear_exception(). The message
+ *       is converted from the exception object on the first call, so throwing
+ *       costs nothing for callers that never read it.
  */
 const char* hlffi_get_exception_message(hlffi_vm* vm);
 
@@ -2200,9 +3082,11 @@ const char* hlffi_get_exception_message(hlffi_vm* vm);
  * Get the last exception stack trace from the VM.
  *
  * @param vm VM instance
- * @return Stack trace string (static buffer, do not free), or NULL
+ * @return Stack trace string (VM buffer, do not free), or NULL
  *
- * @note Only valid immediately after a call that threw an exception
+ * @note The stack addresses are captured when the exception is thrown (up to
+ *       64 frames) and symbolicated on the first call, so the trace stays
+ *       correct even after other exceptions were thrown and caught in Haxe.
  */
 const char* hlffi_get_exception_stack(hlffi_vm* vm);
 
@@ -2212,7 +3096,8 @@ const char* hlffi_get_exception_stack(hlffi_vm* vm);
  * @param vm VM instance
  * @return true if there is a pending exception, false otherwise
  *
- * @note Use this to check if an exception occurred without calling try_call
+ * @note Set by any call that let a Haxe exception escape (hlffi_call_static,
+ *       cached calls, hlffi_new, ...), not only by the try_call functions
  */
 bool hlffi_has_exception(hlffi_vm* vm);
 
@@ -2301,7 +3186,11 @@ typedef struct hlffi_cached_call hlffi_cached_call;
  *
  * @note Caller must free with hlffi_cached_call_free()
  * @note VM must be initialized and bytecode loaded before caching
- * @note Cache remains valid for VM lifetime (no hot reload support yet)
+ * @note Cache remains valid for VM lifetime, including across hot reloads:
+ *       after hlffi_reload_module() the handle re-resolves by name on its
+ *       next call (one integer compare per call otherwise). If the method
+ *       was removed, or no longer matches a typed signature, the call fails
+ *       with the reason in hlffi_get_error() until a later reload restores it.
  *
  * @see hlffi_call_cached(), hlffi_cached_call_free()
  *
@@ -2354,6 +3243,189 @@ hlffi_value* hlffi_call_cached(
     hlffi_value** args
 );
 
+/**
+ * Call a cached static method, writing the result into caller storage.
+ *
+ * Allocation-free variant of hlffi_call_cached(): arguments are unboxed on
+ * the stack and the result is written into `out` instead of a new malloc'd
+ * wrapper. Combined with storage-backed arguments (hlffi_value_int_at() etc.)
+ * a steady-state call performs no malloc/free.
+ *
+ * @param cached Cached method handle
+ * @param argc   Argument count (must match cached method signature)
+ * @param args   Array of hlffi_value* arguments (can be NULL if argc == 0)
+ * @param out    Result slot (e.g. from hlffi_value_init()), or NULL to discard
+ * @return true on success, false on error or exception
+ *
+ * @note `out` keeps its rooting: if it is a rooted value, the new result is
+ *       rooted too; otherwise it is a temporary like hlffi_call_cached()'s
+ * @note Any existing wrapper can be reused as `out` (its old value is replaced)
+ *
+ * @see hlffi_value_storage
+ */
+bool hlffi_call_cached_into(
+    hlffi_cached_call* cached,
+    int argc,
+    hlffi_value** args,
+    hlffi_value* out
+);
+
+/* ---------- Typed (native) cached calls ---------- */
+
+/** Maximum user arguments for typed cached calls */
+#define HLFFI_CACHE_TYPED_MAX_ARGS 4
+
+/**
+ * Raw argument / return value for typed cached calls.
+ *
+ * The member used is given by the signature code at the same position.
+ */
+typedef union hlffi_native_value {
+    int i;              /**< 'i' - Int */
+    double d;           /**< 'd' - Float */
+    bool b;             /**< 'b' - Bool */
+    hlffi_value* o;     /**< 'o' - object, String or Dynamic (argument only) */
+} hlffi_native_value;
+
+/**
+ * Cache a static method for typed (unboxed) calls.
+ *
+ * The method's HashLink function type is checked once against `signature`;
+ * calls through hlffi_call_cached_typed() then pass raw C values directly
+ * to the function pointer - no boxing, no hl_dyn_call.
+ *
+ * Signature format: "<args>:<ret>"
+ * - Argument codes: i = Int, d = Float, b = Bool, o = object/String/Dynamic
+ * - Return codes:   v = Void, i = Int, d = Float, b = Bool
+ * - Examples: ":v" (no args), "ii:i", "id:v", "o:b"
+ *
+ * @param vm          The VM instance
+ * @param class_name  Class name
+ * @param method_name Static method name
+ * @param signature   Expected signature (up to HLFFI_CACHE_TYPED_MAX_ARGS args)
+ * @return Cached call handle, or NULL if not found or the signature does not match
+ *
+ * @note Single (F32), haxe.Int64 and object returns are not supported; use
+ *       hlffi_call_cached_into() for those
+ * @note The handle also works with hlffi_call_cached() / hlffi_call_cached_into()
+ *
+ * Example:
+ * @code
+ * hlffi_cached_call* add = hlffi_cache_static_method_typed(vm, "Math", "add", "ii:i");
+ * hlffi_native_value args[2] = { {.i = 10}, {.i = 20} };
+ * hlffi_native_value sum;
+ * if (hlffi_call_cached_typed(add, args, &sum)) printf("%d\n", sum.i);
+ * @endcode
+ */
+hlffi_cached_call* hlffi_cache_static_method_typed(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* method_name,
+    const char* signature
+);
+
+/**
+ * Cache an instance method for typed (unboxed) calls.
+ *
+ * Same as hlffi_cache_instance_method() plus signature validation (see
+ * hlffi_cache_static_method_typed() for the format; 'this' is implicit).
+ *
+ * @param vm          The VM instance
+ * @param class_name  Class name
+ * @param method_name Instance method name
+ * @param signature   Expected signature, excluding 'this'
+ * @return Cached call handle, or NULL if not found or the signature does not match
+ */
+hlffi_cached_call* hlffi_cache_instance_method_typed(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* method_name,
+    const char* signature
+);
+
+/**
+ * Call a typed cached static method with raw C values.
+ *
+ * @param cached Handle from hlffi_cache_static_method_typed()
+ * @param args   Arguments matching the cached signature (can be NULL if none)
+ * @param ret    Return value (can be NULL to discard; untouched for Void)
+ * @return true on success, false on invalid handle or exception
+ *
+ * @note No heap allocation; String arguments passed as 'o' follow the same
+ *       HBYTES -> String conversion as hlffi_call_cached()
+ */
+bool hlffi_call_cached_typed(
+    hlffi_cached_call* cached,
+    const hlffi_native_value* args,
+    hlffi_native_value* ret
+);
+
+/**
+ * Call a typed cached instance method with raw C values.
+ *
+ * @param cached   Handle from hlffi_cache_instance_method_typed()
+ * @param instance Instance of the cached class or one of its subclasses
+ * @param args     Arguments matching the cached signature (can be NULL if none)
+ * @param ret      Return value (can be NULL to discard; untouched for Void)
+ * @return true on success, false on invalid handle/instance or exception
+ *
+ * Example:
+ * @code
+ * hlffi_cached_call* update = hlffi_cache_instance_method_typed(vm, "Entity", "update", "d:v");
+ * hlffi_native_value dt = { .d = 0.016 };
+ * for (int i = 0; i < count; i++) hlffi_call_cached_method_typed(update, entities[i], &dt, NULL);
+ * @endcode
+ */
+bool hlffi_call_cached_method_typed(
+    hlffi_cached_call* cached,
+    hlffi_value* instance,
+    const hlffi_native_value* args,
+    hlffi_native_value* ret
+);
+
+/**
+ * One entry of a batched cached call (typed, unboxed arguments).
+ *
+ * Arguments are raw C values, so entries can be prepared on any thread
+ * without allocating Haxe values outside the VM thread.
+ */
+typedef struct hlffi_thread_cached_call {
+    hlffi_cached_call* cached;          /**< Typed handle (hlffi_cache_*_method_typed) */
+    hlffi_value* instance;              /**< Receiver for instance methods, NULL for static */
+    const hlffi_native_value* args;     /**< Arguments matching the cached signature */
+    hlffi_native_value ret;             /**< Out: return value */
+    bool ok;                            /**< Out: false on invalid handle or exception */
+} hlffi_thread_cached_call;
+
+/**
+ * Run N typed cached calls in the VM thread with a single enqueue and wait.
+ *
+ * THREADED mode counterpart of hlffi_thread_call_batch() for cached calls.
+ *
+ * Each entry is executed with hlffi_call_cached_typed() (or
+ * hlffi_call_cached_method_typed() when `instance` is set).
+ *
+ * @param vm    VM instance
+ * @param calls Array of entries (ret/ok written back into it)
+ * @param count Number of entries (0 returns immediately)
+ * @return HLFFI_OK if the batch ran (check each entry's `ok`), error code otherwise
+ *         (HLFFI_ERROR_THREAD_NOT_STARTED if the thread stopped first)
+ *
+ * @note Only use in THREADED mode
+ * @note `instance` values must stay alive until the call returns (e.g. from hlffi_new)
+ *
+ * Example:
+ * @code
+ * hlffi_native_value dt = { .d = 0.016 };
+ * hlffi_thread_cached_call calls[256];
+ * for (int i = 0; i < n; i++) {
+ *     calls[i] = (hlffi_thread_cached_call){ .cached = update, .instance = entities[i], .args = &dt };
+ * }
+ * hlffi_thread_call_cached_batch(vm, calls, n);
+ * @endcode
+ */
+hlffi_error_code hlffi_thread_call_cached_batch(hlffi_vm* vm, hlffi_thread_cached_call* calls, int count);
+
 /**
  * Free a cached call handle.
  *
@@ -2366,15 +3438,32 @@ hlffi_value* hlffi_call_cached(
 void hlffi_cached_call_free(hlffi_cached_call* cached);
 
 /**
- * Cache an instance method lookup (NOT YET IMPLEMENTED).
+ * Cache an instance method lookup for repeated calls on many instances.
  *
- * Instance methods require a different caching strategy since the closure
- * is instance-specific. This function currently returns NULL.
+ * Instance closures are per-object, so the method implementation is cached
+ * per receiver type instead: the method name is hashed once here, and each
+ * receiver type (the class or a subclass) is resolved once on first use and
+ * remembered in a small inline dispatch cache. Subsequent calls dispatch with
+ * a pointer compare - no string hashing, no field lookup, no closure allocation.
  *
  * @param vm          The VM instance
- * @param class_name  Class name
- * @param method_name Method name
- * @return NULL (not yet implemented)
+ * @param class_name  Class name (e.g., "Player", "game.Entity")
+ * @param method_name Instance method name
+ * @return Cached call handle, or NULL if the class/method was not found
+ *
+ * @note Free with hlffi_cached_call_free() when done
+ * @note Overrides are honored: calls on a subclass instance use its override
+ * @note Use hlffi_call_cached_method() to call (hlffi_call_cached() rejects it)
+ *
+ * Example:
+ * @code
+ * hlffi_cached_call* update = hlffi_cache_instance_method(vm, "Entity", "update");
+ * for (int i = 0; i < count; i++) {
+ *     hlffi_value* r = hlffi_call_cached_method(update, entities[i], 1, &dt);
+ *     hlffi_value_free(r);
+ * }
+ * hlffi_cached_call_free(update);
+ * @endcode
  */
 hlffi_cached_call* hlffi_cache_instance_method(
     hlffi_vm* vm,
@@ -2383,13 +3472,19 @@ hlffi_cached_call* hlffi_cache_instance_method(
 );
 
 /**
- * Call a cached instance method (NOT YET IMPLEMENTED).
+ * Call a cached instance method.
  *
- * @param cached   Cached method handle
- * @param instance Instance to call method on
- * @param argc     Argument count
- * @param args     Arguments
- * @return NULL (not yet implemented)
+ * @param cached   Handle from hlffi_cache_instance_method()
+ * @param instance Instance of the cached class or one of its subclasses
+ * @param argc     Argument count (excluding 'this', must match signature)
+ * @param args     Array of hlffi_value* arguments (can be NULL if argc == 0)
+ * @return Return value or NULL on error/exception
+ *
+ * @note Caller must free return value with hlffi_value_free()
+ * @note Returns NULL with HLFFI_ERROR_TYPE_MISMATCH if instance is not of
+ *       the cached class (or a subclass)
+ * @note Receiver types beyond the inline cache size are re-resolved on
+ *       miss; calls stay correct, only the first call per type is slower
  */
 hlffi_value* hlffi_call_cached_method(
     hlffi_cached_call* cached,
@@ -2398,6 +3493,227 @@ hlffi_value* hlffi_call_cached_method(
     hlffi_value** args
 );
 
+/**
+ * Call a cached instance method, writing the result into caller storage.
+ *
+ * Allocation-free variant of hlffi_call_cached_method(); see
+ * hlffi_call_cached_into() for the semantics of `out`.
+ *
+ * @param cached   Handle from hlffi_cache_instance_method()
+ * @param instance Instance of the cached class or one of its subclasses
+ * @param argc     Argument count (excluding 'this', must match signature)
+ * @param args     Array of hlffi_value* arguments (can be NULL if argc == 0)
+ * @param out      Result slot, or NULL to discard
+ * @return true on success, false on error or exception
+ */
+bool hlffi_call_cached_method_into(
+    hlffi_cached_call* cached,
+    hlffi_value* instance,
+    int argc,
+    hlffi_value** args,
+    hlffi_value* out
+);
+
+/* ---------- Cached field access ---------- */
+
+/**
+ * Opaque cached field handle.
+ *
+ * Holds the resolved byte offset and type of an instance field, so typed
+ * accessors read/write the object memory directly - no name hashing, no
+ * field lookup, no hlffi_value allocation.
+ */
+typedef struct hlffi_cached_field hlffi_cached_field;
+
+/**
+ * Cache an instance field lookup for repeated access on many instances.
+ *
+ * The field name is resolved once to its offset in the object layout.
+ * Subclasses extend their parent's layout, so the handle works for
+ * instances of the class and of any subclass.
+ *
+ * @param vm         The VM instance
+ * @param class_name Class name (e.g., "Entity", "game.Entity")
+ * @param field_name Instance field name (Int, Float or Bool typed)
+ * @return Cached field handle, or NULL if the class/field was not found or
+ *         the field is not a scalar (use hlffi_get_field() for those)
+ *
+ * @note Free with hlffi_cached_field_free() when done
+ * @note Survives hot reload: the offset is re-resolved on the next access
+ * @note Haxe properties with getters/setters are bypassed: the accessors
+ *       touch the physical field only
+ *
+ * Example:
+ * @code
+ * hlffi_cached_field* px = hlffi_cache_field(vm, "Entity", "x");
+ * hlffi_cached_field* vx = hlffi_cache_field(vm, "Entity", "vx");
+ * for (int i = 0; i < count; i++) {
+ *     double x = hlffi_cached_field_get_float(px, entities[i], 0.0);
+ *     hlffi_cached_field_set_float(px, entities[i], x + hlffi_cached_field_get_float(vx, entities[i], 0.0) * dt);
+ * }
+ * hlffi_cached_field_free(px);
+ * hlffi_cached_field_free(vx);
+ * @endcode
+ */
+hlffi_cached_field* hlffi_cache_field(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* field_name
+);
+
+/**
+ * Get the declared type of a cached field.
+ *
+ * @param field Cached field handle
+ * @return Field type (query with hlffi_type_get_kind()), or NULL
+ */
+hlffi_type* hlffi_cached_field_type(const hlffi_cached_field* field);
+
+/**
+ * Read a cached Int field (Int, UInt8, UInt16).
+ *
+ * @param field    Handle from hlffi_cache_field()
+ * @param obj      Instance of the cached class or one of its subclasses
+ * @param fallback Returned on NULL/mismatched instance or non-Int field
+ * @return Field value or fallback
+ *
+ * @note Sets HLFFI_ERROR_TYPE_MISMATCH if obj is not of the cached class
+ */
+int hlffi_cached_field_get_int(hlffi_cached_field* field, hlffi_value* obj, int fallback);
+
+/**
+ * Read a cached Float field (Float / Single).
+ *
+ * @param field    Handle from hlffi_cache_field()
+ * @param obj      Instance of the cached class or one of its subclasses
+ * @param fallback Returned on NULL/mismatched instance or non-Float field
+ * @return Field value or fallback
+ */
+double hlffi_cached_field_get_float(hlffi_cached_field* field, hlffi_value* obj, double fallback);
+
+/**
+ * Read a cached Bool field.
+ *
+ * @param field    Handle from hlffi_cache_field()
+ * @param obj      Instance of the cached class or one of its subclasses
+ * @param fallback Returned on NULL/mismatched instance or non-Bool field
+ * @return Field value or fallback
+ */
+bool hlffi_cached_field_get_bool(hlffi_cached_field* field, hlffi_value* obj, bool fallback);
+
+/**
+ * Write a cached Int field (UInt8/UInt16 fields are truncated).
+ *
+ * @param field Handle from hlffi_cache_field()
+ * @param obj   Instance of the cached class or one of its subclasses
+ * @param value New value
+ * @return true on success, false on NULL/mismatched instance or non-Int field
+ */
+bool hlffi_cached_field_set_int(hlffi_cached_field* field, hlffi_value* obj, int value);
+
+/**
+ * Write a cached Float field (Single fields are narrowed to float).
+ *
+ * @param field Handle from hlffi_cache_field()
+ * @param obj   Instance of the cached class or one of its subclasses
+ * @param value New value
+ * @return true on success, false on NULL/mismatched instance or non-Float field
+ */
+bool hlffi_cached_field_set_float(hlffi_cached_field* field, hlffi_value* obj, double value);
+
+/**
+ * Write a cached Bool field.
+ *
+ * @param field Handle from hlffi_cache_field()
+ * @param obj   Instance of the cached class or one of its subclasses
+ * @param value New value
+ * @return true on success, false on NULL/mismatched instance or non-Bool field
+ */
+bool hlffi_cached_field_set_bool(hlffi_cached_field* field, hlffi_value* obj, bool value);
+
+/**
+ * Free a cached field handle. Safe to call with NULL.
+ *
+ * @param field Cached field handle (can be NULL)
+ */
+void hlffi_cached_field_free(hlffi_cached_field* field);
+
+/* ---------- Bulk field sync (struct of arrays) ---------- */
+
+/**
+ * One C column of a bulk field copy: a cached field and a contiguous buffer.
+ *
+ * `type` is the C element type of `data`. It may differ from the Haxe field
+ * type (e.g. a Float field gathered into a float buffer); values are then
+ * converted. Matching types are copied as-is.
+ */
+typedef struct hlffi_field_column {
+    hlffi_cached_field* field;  /**< Handle from hlffi_cache_field() */
+    hlffi_type_kind type;       /**< HLFFI_TYPE_I32, HLFFI_TYPE_F32, HLFFI_TYPE_F64 or HLFFI_TYPE_BOOL */
+    void* data;                 /**< int32_t*, float*, double* or bool* buffer */
+} hlffi_field_column;
+
+/**
+ * Copy fields of every object in an array into contiguous C arrays.
+ *
+ * Element i's fields land in columns[c].data[i]. No hlffi_value is created
+ * per element: the array is resolved once, and fields are read at their
+ * cached offsets.
+ *
+ * @param vm        VM instance (for error reporting)
+ * @param objects   Array<T> of class instances (or a NativeArray of objects)
+ * @param columns   Columns to fill
+ * @param ncolumns  Number of columns
+ * @param max_count Capacity of the column buffers in elements (-1: array length)
+ * @return Number of elements copied, or -1 on error
+ *
+ * @note Null elements read as zero
+ * @note Fails with HLFFI_ERROR_TYPE_MISMATCH if an element is not of the
+ *       cached field's class (or a subclass)
+ *
+ * Example:
+ * @code
+ * hlffi_field_column cols[] = {
+ *     { px, HLFFI_TYPE_F32, xs }, { py, HLFFI_TYPE_F32, ys },
+ *     { vx, HLFFI_TYPE_F32, vxs }, { vy, HLFFI_TYPE_F32, vys },
+ * };
+ * int n = hlffi_array_gather_fields(vm, bodies, cols, 4, MAX_BODIES);
+ * physics_step(xs, ys, vxs, vys, n, dt);
+ * hlffi_array_scatter_fields(vm, bodies, cols, 2, n);  // write back positions only
+ * @endcode
+ */
+int hlffi_array_gather_fields(
+    hlffi_vm* vm,
+    hlffi_value* objects,
+    const hlffi_field_column* columns,
+    int ncolumns,
+    int max_count
+);
+
+/**
+ * Write contiguous C arrays back into fields of every object in an array.
+ *
+ * Inverse of hlffi_array_gather_fields(): columns[c].data[i] is stored into
+ * element i's field.
+ *
+ * @param vm       VM instance (for error reporting)
+ * @param objects  Array<T> of class instances (or a NativeArray of objects)
+ * @param columns  Columns to write
+ * @param ncolumns Number of columns
+ * @param count    Number of elements to write (-1 or > length: array length)
+ * @return Number of elements written, or -1 on error
+ *
+ * @note Null elements are skipped
+ * @note On a type mismatch, elements before the offending one are already written
+ */
+int hlffi_array_scatter_fields(
+    hlffi_vm* vm,
+    hlffi_value* objects,
+    const hlffi_field_column* columns,
+    int ncolumns,
+    int count
+);
+
 #ifdef __cplusplus
 }
 
@@ -23,54 +23,87 @@
 
 /* ========== CACHED CALL STRUCTURE ========== */
 
+/* Receiver types remembered per instance method cache (class + subclasses) */
+#define HLFFI_CACHE_DISPATCH_SLOTS 4
+
+/* Resolved method implementation for one receiver type */
+typedef struct {
+    hl_type* type;          /* Receiver type (cached class or a subclass) */
+    void* fun;              /* Method implementation for that type */
+    hl_type* ftype;         /* Method function type: (this, args...) -> ret */
+    unsigned string_args;   /* Bit k set: function arg k expects a String object */
+} hlffi_cached_dispatch;
+
 struct hlffi_cached_call {
     vclosure* closure;      /* Pre-resolved function pointer (GC-rooted) */
     int nargs;              /* Expected argument count for validation */
     bool is_rooted;         /* GC root management flag */
+    unsigned string_args;   /* Bit k set: closure arg k expects a String object */
+
+    /* Instance methods (closure == NULL): per-type dispatch cache.
+     * Types and code pointers are not GC-managed - no roots needed. */
+    hlffi_vm* vm;                   /* For error reporting */
+    hl_type* class_type;            /* Class the method was cached for */
+    int method_hash;                /* Pre-computed hl_hash_utf8(method_name) */
+    hlffi_cached_dispatch dispatch[HLFFI_CACHE_DISPATCH_SLOTS];
+    int dispatch_count;
+    int dispatch_next;              /* Round-robin replacement slot */
+
+    /* Typed (native) calls: signature validated once at cache time */
+    bool typed;
+    int typed_nargs;                            /* User arguments (excluding this/closure value) */
+    char typed_args[HLFFI_CACHE_TYPED_MAX_ARGS + 1];  /* Argument codes, e.g. "id" */
+    char typed_ret;                             /* Return code: 'v', 'i', 'd' or 'b' */
+    unsigned typed_string_args;                 /* Bit k set: arg k expects a String object */
+    hl_type* typed_string_type;                 /* String type to retag HBYTES arguments with */
+
+    /* Hot reload: names to re-resolve by, and the module generation the
+     * resolved pointers belong to */
+    char* class_name;
+    char* method_name;
+    unsigned generation;
 };
 
-/* ========== STATIC METHOD CACHING ========== */
+static bool refresh_cached_call(hlffi_cached_call* cached);
 
-hlffi_cached_call* hlffi_cache_static_method(
-    hlffi_vm* vm,
-    const char* class_name,
-    const char* method_name
-) {
-    if (!vm || !class_name || !method_name) {
-        if (vm) {
-            snprintf(vm->error_msg, sizeof(vm->error_msg),
-                     "NULL parameter in hlffi_cache_static_method");
-        }
-        return NULL;
-    }
+/* One compare on the hot path; re-resolves after a module patch */
+static inline bool cached_call_current(hlffi_cached_call* cached) {
+    return cached->generation == cached->vm->module_generation || refresh_cached_call(cached);
+}
 
-    if (!vm->module || !vm->module->code) {
-        snprintf(vm->error_msg, sizeof(vm->error_msg),
-                 "VM not initialized - call hlffi_load_file() first");
-        return NULL;
+/* ========== STRING ARGUMENTS ========== */
+
+/* Check whether a type is the Haxe String class */
+static bool is_string_type(hl_type* t) {
+    if (t->kind != HOBJ || !t->obj || !t->obj->name) return false;
+    char type_name_buf[128];
+    utostr(type_name_buf, sizeof(type_name_buf), t->obj->name);
+    return strcmp(type_name_buf, "String") == 0;
+}
+
+/* Arguments covered by the precomputed String mask; later ones are checked per call */
+#define STRING_MASK_ARGS ((int)(sizeof(unsigned) * 8))
+
+/* Bit k set: argument k of tf is the String class (computed once at cache time) */
+static unsigned string_arg_mask(hl_type_fun* tf) {
+    unsigned mask = 0;
+    for (int i = 0; i < tf->nargs && i < STRING_MASK_ARGS; i++) {
+        if (is_string_type(tf->args[i])) mask |= 1u << i;
     }
+    return mask;
+}
 
+/* ========== STATIC METHOD CACHING ========== */
+
+/* Resolve the closure of a static method (at cache time and after reload) */
+static vclosure* resolve_static_closure(hlffi_vm* vm, const char* class_name, const char* method_name) {
     /* Update GC stack top for safe HashLink API calls */
     HLFFI_UPDATE_STACK_TOP();
 
-    /* 1. Find class type (expensive - but only once) */
-    hl_type* class_type = NULL;
-    int class_hash = hl_hash_utf8(class_name);
+    /* 1. Find class type (type name index - O(1)) */
+    hl_type* class_type = hlffi_type_index_lookup_class(vm, class_name);
     int method_hash = hl_hash_utf8(method_name);
 
-    hl_code* code = vm->module->code;
-
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type* t = code->types + i;  /* Pointer arithmetic, not array access */
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            char* type_name = hl_to_utf8(t->obj->name);
-            if (type_name && hl_hash_utf8(type_name) == class_hash) {
-                class_type = t;
-                break;
-            }
-        }
-    }
-
     if (!class_type) {
         snprintf(vm->error_msg, sizeof(vm->error_msg),
                  "Class '%s' not found", class_name);
@@ -114,19 +147,70 @@ hlffi_cached_call* hlffi_cache_static_method(
         return NULL;
     }
 
-    /* 4. Create cache entry (use calloc to zero memory) */
+    return closure;
+}
+
+/* Allocate a cache entry remembering the names it was resolved from */
+static hlffi_cached_call* cached_call_alloc(hlffi_vm* vm, const char* class_name, const char* method_name) {
     hlffi_cached_call* cache = (hlffi_cached_call*)calloc(1, sizeof(hlffi_cached_call));
+    if (cache) {
+        cache->class_name = strdup(class_name);
+        cache->method_name = strdup(method_name);
+        if (!cache->class_name || !cache->method_name) {
+            free(cache->class_name);
+            free(cache->method_name);
+            free(cache);
+            cache = NULL;
+        }
+    }
+
     if (!cache) {
         snprintf(vm->error_msg, sizeof(vm->error_msg),
                  "Failed to allocate cache entry");
         return NULL;
     }
 
-    /* 5. Assign closure FIRST */
+    cache->vm = vm;
+    cache->generation = vm->module_generation;
+    return cache;
+}
+
+hlffi_cached_call* hlffi_cache_static_method(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* method_name
+) {
+    if (!vm || !class_name || !method_name) {
+        if (vm) {
+            snprintf(vm->error_msg, sizeof(vm->error_msg),
+                     "NULL parameter in hlffi_cache_static_method");
+        }
+        return NULL;
+    }
+
+    if (!vm->module || !vm->module->code) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "VM not initialized - call hlffi_load_file() first");
+        return NULL;
+    }
+
+    vclosure* closure = resolve_static_closure(vm, class_name, method_name);
+    if (!closure) {
+        return NULL;
+    }
+
+    /* 5. Create cache entry (zeroed) */
+    hlffi_cached_call* cache = cached_call_alloc(vm, class_name, method_name);
+    if (!cache) {
+        return NULL;
+    }
+
+    /* 6. Assign closure FIRST */
     cache->closure = closure;
     cache->nargs = -1;
+    cache->string_args = string_arg_mask(closure->t->fun);
 
-    /* 6. Add GC root AFTER assignment */
+    /* 7. Add GC root AFTER assignment */
     hl_add_root(&cache->closure);
     cache->is_rooted = true;
 
@@ -135,75 +219,112 @@ hlffi_cached_call* hlffi_cache_static_method(
 
 /* ========== CACHED CALL EXECUTION ========== */
 
-hlffi_value* hlffi_call_cached(
-    hlffi_cached_call* cached,
-    int argc,
-    hlffi_value** args
-) {
-    if (!cached) {
+/* TYPE CONVERSION: Convert HBYTES to String objects if the function expects HOBJ String.
+ * This is needed because hlffi_value_string creates HBYTES but Haxe methods expect String objects.
+ * string_args is the precomputed string_arg_mask(tf), so the common case is a bit test. */
+static void retag_string_args(hl_type_fun* tf, unsigned string_args, vdynamic** hl_args, int first, int count) {
+    if (!string_args && tf->nargs <= STRING_MASK_ARGS) return;
+
+    for (int i = first; i < count && i < tf->nargs; i++) {
+        vdynamic* arg = hl_args[i];
+        if (!arg || arg->t->kind != HBYTES) continue;
+
+        bool expects_string = i < STRING_MASK_ARGS ? (string_args & (1u << i)) != 0
+                                                   : is_string_type(tf->args[i]);
+        if (expects_string) {
+            arg->t = tf->args[i];
+        }
+    }
+}
+
+/* Allocate a temporary (unrooted) wrapper for a call result */
+static hlffi_value* wrap_result(hlffi_vm* vm, vdynamic* result) {
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
+    if (!wrapped) {
         return NULL;
     }
 
+    wrapped->hl_value = result; /* NULL is valid (represents Haxe null) */
+    wrapped->is_rooted = false; /* Temporary wrapper - NOT rooted */
+
+    return wrapped;
+}
+
+/* Static call core: arguments are unboxed into a stack array, no heap use */
+static bool invoke_cached(hlffi_cached_call* cached, int argc, hlffi_value** args, vdynamic** result) {
+    if (argc < 0 || (argc > 0 && !args)) {
+        return false;
+    }
+
+    if (!cached_call_current(cached)) {
+        return false;
+    }
+
     /* Update GC stack top for safe calls */
     HLFFI_UPDATE_STACK_TOP();
 
     /* Prepare arguments - unbox hlffi_value** to vdynamic** */
     vdynamic** hl_args = NULL;
     if (argc > 0) {
-        hl_args = (vdynamic**)malloc(sizeof(vdynamic*) * argc);
-        if (!hl_args) {
-            return NULL;
-        }
+        hl_args = (vdynamic**)alloca(sizeof(vdynamic*) * argc);
         for (int i = 0; i < argc; i++) {
             hl_args[i] = args[i] ? args[i]->hl_value : NULL;
         }
-    }
 
-    /* TYPE CONVERSION: Convert HBYTES to String objects if method expects HOBJ String
-     * This is needed because hlffi_value_string creates HBYTES but Haxe methods expect String objects */
-    if (argc > 0 && cached->closure->t->kind == HFUN) {
-        for (int i = 0; i < argc && i < cached->closure->t->fun->nargs; i++) {
-            hl_type* expected_type = cached->closure->t->fun->args[i];
-            vdynamic* arg = hl_args[i];
-
-            if (arg && expected_type->kind == HOBJ && arg->t->kind == HBYTES) {
-                char type_name_buf[128];
-                if (expected_type->obj && expected_type->obj->name) {
-                    utostr(type_name_buf, sizeof(type_name_buf), expected_type->obj->name);
-                    if (strcmp(type_name_buf, "String") == 0) {
-                        vstring* bytes_str = (vstring*)arg;
-                        bytes_str->t = expected_type;
-                        hl_args[i] = (vdynamic*)bytes_str;
-                    }
-                }
-            }
+        if (cached->closure->t->kind == HFUN) {
+            retag_string_args(cached->closure->t->fun, cached->string_args, hl_args, 0, argc);
         }
     }
 
     /* Call with exception handling - use hl_dyn_call_safe like hlffi_call_static */
     bool isExc = false;
-    vdynamic* result = hl_dyn_call_safe(cached->closure, hl_args, argc, &isExc);
+    *result = hl_dyn_call_safe(cached->closure, hl_args, argc, &isExc);
 
-    /* Free argument array */
-    if (hl_args) {
-        free(hl_args);
+    if (isExc) {
+        hlffi_exception_capture(cached->vm, *result);
+        hlffi_set_error(cached->vm, HLFFI_ERROR_EXCEPTION_THROWN, "Exception thrown during cached call");
+        *result = NULL;
+        return false;
     }
+    return true;
+}
 
-    /* Check for exception */
-    if (isExc) {
-        return NULL;
+hlffi_value* hlffi_call_cached(
+    hlffi_cached_call* cached,
+    int argc,
+    hlffi_value** args
+) {
+    if (!cached || !cached->closure) {
+        return NULL;  /* Instance method caches go through hlffi_call_cached_method */
     }
 
-    /* Wrap result */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
-    if (!wrapped) {
+    vdynamic* result = NULL;
+    if (!invoke_cached(cached, argc, args, &result)) {
         return NULL;
     }
 
-    wrapped->hl_value = result; /* NULL is valid (represents Haxe null) */
-    wrapped->is_rooted = false; /* Temporary wrapper - NOT rooted */
+    return wrap_result(cached->vm, result);
+}
 
-    return wrapped;
+bool hlffi_call_cached_into(
+    hlffi_cached_call* cached,
+    int argc,
+    hlffi_value** args,
+    hlffi_value* out
+) {
+    if (!cached || !cached->closure) {
+        return false;
+    }
+
+    vdynamic* result = NULL;
+    if (!invoke_cached(cached, argc, args, &result)) {
+        return false;
+    }
+
+    if (out) {
+        out->hl_value = result;  /* Slot keeps its rooting (root is the slot address) */
+    }
+    return true;
 }
 
 /* ========== CACHE CLEANUP ========== */
@@ -219,11 +340,93 @@ void hlffi_cached_call_free(hlffi_cached_call* cached) {
         cached->is_rooted = false;
     }
 
+    free(cached->class_name);
+    free(cached->method_name);
     free(cached);
 }
 
 /* ========== INSTANCE METHOD CACHING ========== */
 
+/*
+ * Instance closures are per-object, so instead of a closure we cache the
+ * method implementation per receiver type. The hash is computed once; each
+ * receiver type is resolved once through the runtime lookup tables (walking
+ * parent classes) and remembered in a small inline cache, so calls on any
+ * instance of the class or its subclasses dispatch with a pointer compare.
+ */
+
+/* Resolve method implementation for receiver type t (same lookup rules as
+ * hlffi_call_method's prototype path, but walking parent runtime objects) */
+static bool resolve_dispatch(hl_type* t, int method_hash, hlffi_cached_dispatch* out) {
+    /* hl_get_obj_rt (JIT, field caches, map/array helpers) creates rt
+     * without methods: only the proto fills them in */
+    hl_runtime_obj* rt = t->obj->rt;
+    if (!rt || !rt->methods) rt = hl_get_obj_proto(t);
+
+    /* The first runtime object declaring the method holds the implementation
+     * that applies to t (an override would be declared in a closer one) */
+    for (; rt; rt = rt->parent) {
+        if (!rt->lookup) continue;
+
+        hl_field_lookup* l = hl_lookup_find(rt->lookup, rt->nlookup, method_hash);
+        if (!l) continue;
+
+        /* Non-negative field_index is a data field, not a method */
+        if (l->field_index >= 0) return false;
+
+        int method_idx = -(l->field_index + 1);
+        if (method_idx >= rt->nmethods || !rt->methods || !rt->methods[method_idx]) return false;
+        if (!l->t || l->t->kind != HFUN || l->t->fun->nargs < 1) return false;
+
+        out->type = t;
+        out->fun = rt->methods[method_idx];
+        out->ftype = l->t;
+        out->string_args = string_arg_mask(l->t->fun);
+        return true;
+    }
+
+    return false;
+}
+
+/* Check if t is cls or a subclass of cls */
+static bool is_same_or_subclass(hl_type* t, hl_type* cls) {
+    while (t) {
+        if (t == cls) return true;
+        if (t->kind != HOBJ || !t->obj) return false;
+        t = t->obj->super;
+    }
+    return false;
+}
+
+/* Find dispatch entry for receiver type, resolving and caching on miss */
+static hlffi_cached_dispatch* find_dispatch(hlffi_cached_call* cached, hl_type* t) {
+    for (int i = 0; i < cached->dispatch_count; i++) {
+        if (cached->dispatch[i].type == t) {
+            return &cached->dispatch[i];
+        }
+    }
+
+    /* Miss: first call with this receiver type */
+    if (!is_same_or_subclass(t, cached->class_type)) {
+        return NULL;
+    }
+
+    hlffi_cached_dispatch resolved;
+    if (!resolve_dispatch(t, cached->method_hash, &resolved)) {
+        return NULL;
+    }
+
+    int slot;
+    if (cached->dispatch_count < HLFFI_CACHE_DISPATCH_SLOTS) {
+        slot = cached->dispatch_count++;
+    } else {
+        slot = cached->dispatch_next;
+        cached->dispatch_next = (cached->dispatch_next + 1) % HLFFI_CACHE_DISPATCH_SLOTS;
+    }
+    cached->dispatch[slot] = resolved;
+    return &cached->dispatch[slot];
+}
+
 hlffi_cached_call* hlffi_cache_instance_method(
     hlffi_vm* vm,
     const char* class_name,
@@ -237,11 +440,112 @@ hlffi_cached_call* hlffi_cache_instance_method(
         return NULL;
     }
 
-    /* Instance method caching not yet implemented -
-     * requires different caching strategy since closures are instance-specific */
-    snprintf(vm->error_msg, sizeof(vm->error_msg),
-             "Instance method caching not yet implemented");
-    return NULL;
+    HLFFI_UPDATE_STACK_TOP();
+
+    /* 1. Find class type */
+    hl_type* class_type = (hl_type*)hlffi_find_type(vm, class_name);
+    if (!class_type || class_type->kind != HOBJ || !class_type->obj) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Class '%s' not found", class_name);
+        return NULL;
+    }
+
+    /* 2. Resolve method for the class itself (validates it exists) */
+    int method_hash = hl_hash_utf8(method_name);
+    hlffi_cached_dispatch resolved;
+    if (!resolve_dispatch(class_type, method_hash, &resolved)) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Instance method '%s' not found in class '%s'", method_name, class_name);
+        return NULL;
+    }
+
+    /* 3. Create cache entry */
+    hlffi_cached_call* cache = cached_call_alloc(vm, class_name, method_name);
+    if (!cache) {
+        return NULL;
+    }
+
+    cache->closure = NULL;
+    cache->is_rooted = false;
+    cache->nargs = resolved.ftype->fun->nargs - 1;  /* Excluding 'this' */
+    cache->class_type = class_type;
+    cache->method_hash = method_hash;
+    cache->dispatch[0] = resolved;
+    cache->dispatch_count = 1;
+
+    return cache;
+}
+
+/* Instance call core: [this, args...] on the stack, direct dispatch */
+static bool invoke_cached_method(
+    hlffi_cached_call* cached,
+    hlffi_value* instance,
+    int argc,
+    hlffi_value** args,
+    vdynamic** result
+) {
+    hlffi_vm* vm = cached->vm;
+
+    if (!instance || !instance->hl_value) {
+        hlffi_set_error(vm, HLFFI_ERROR_NULL_VALUE, "Instance is NULL");
+        return false;
+    }
+
+    if (argc != cached->nargs || (argc > 0 && !args)) {
+        hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT,
+                        "Argument count does not match cached method signature");
+        return false;
+    }
+
+    vdynamic* obj = instance->hl_value;
+    if (obj->t->kind != HOBJ) {
+        hlffi_set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Instance is not an object");
+        return false;
+    }
+
+    if (!cached_call_current(cached)) {
+        return false;
+    }
+
+    /* Direct dispatch: pointer compare on receiver type, no hashing */
+    hlffi_cached_dispatch* d = find_dispatch(cached, obj->t);
+    if (!d) {
+        hlffi_set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                        "Instance is not of the cached class (or a subclass)");
+        return false;
+    }
+
+    HLFFI_UPDATE_STACK_TOP();
+
+    /* Arguments: [this, arg1, arg2, ...] - method type includes 'this' */
+    int total_args = argc + 1;
+    vdynamic** hl_args = (vdynamic**)alloca(total_args * sizeof(vdynamic*));
+    hl_args[0] = obj;
+    for (int i = 0; i < argc; i++) {
+        hl_args[i + 1] = args[i] ? args[i]->hl_value : NULL;
+    }
+
+    retag_string_args(d->ftype->fun, d->string_args, hl_args, 1, total_args);
+
+    /* Call the implementation directly with 'this' as first argument
+     * (same pattern as constructor calls in hlffi_new) */
+    vclosure cl;
+    cl.t = d->ftype;
+    cl.fun = d->fun;
+    cl.hasValue = 0;
+    cl.value = NULL;
+
+    bool isExc = false;
+    *result = hl_dyn_call_safe(&cl, hl_args, total_args, &isExc);
+
+    if (isExc) {
+        hlffi_exception_capture(vm, *result);
+        hlffi_set_error(vm, HLFFI_ERROR_EXCEPTION_THROWN, "Exception thrown during cached method call");
+        *result = NULL;
+        return false;
+    }
+
+    return true;
 }
 
 hlffi_value* hlffi_call_cached_method(
@@ -250,10 +554,919 @@ hlffi_value* hlffi_call_cached_method(
     int argc,
     hlffi_value** args
 ) {
-    /* Not yet implemented - instance methods require different caching strategy */
-    (void)cached;
-    (void)instance;
-    (void)argc;
-    (void)args;
-    return NULL;
+    if (!cached || !cached->class_type) {
+        return NULL;  /* Not an instance method cache */
+    }
+
+    vdynamic* result = NULL;
+    if (!invoke_cached_method(cached, instance, argc, args, &result)) {
+        return NULL;
+    }
+
+    return wrap_result(cached->vm, result);
+}
+
+bool hlffi_call_cached_method_into(
+    hlffi_cached_call* cached,
+    hlffi_value* instance,
+    int argc,
+    hlffi_value** args,
+    hlffi_value* out
+) {
+    if (!cached || !cached->class_type) {
+        return false;
+    }
+
+    vdynamic* result = NULL;
+    if (!invoke_cached_method(cached, instance, argc, args, &result)) {
+        return false;
+    }
+
+    if (out) {
+        out->hl_value = result;  /* Slot keeps its rooting (root is the slot address) */
+    }
+    return true;
+}
+
+/* ========== TYPED (NATIVE) CALLS ========== */
+
+/*
+ * Typed calls skip boxing entirely: the function type is checked once against
+ * a signature string when caching, and each call passes raw C values straight
+ * to the function pointer - the same way hl.h's hl_call1..4 macros call
+ * closures from C code.
+ *
+ * Signature format: "<args>:<ret>", e.g. "id:v" = (Int, Float) -> Void
+ *   i = Int, d = Float, b = Bool, o = object/String/dynamic (hlffi_value*),
+ *   v = Void (return only)
+ *
+ * At the machine level each argument is either a word (Int, Bool, pointer)
+ * or a double, so calls are dispatched on (arity, double-mask) to a direct
+ * call through a matching function pointer type.
+ */
+
+/* Maximum native arity: user args + this (instance) or closure value (static) */
+#define TYPED_MAX_NATIVE_ARGS (HLFFI_CACHE_TYPED_MAX_ARGS + 1)
+
+/* Native signature code for a HashLink type, 0 if unsupported by typed calls */
+static char typed_code(hl_type* t) {
+    switch (t->kind) {
+        case HVOID: return 'v';
+        case HI32:  return 'i';
+        case HF64:  return 'd';
+        case HBOOL: return 'b';
+        default:    return hl_is_ptr(t) ? 'o' : 0;
+    }
+}
+
+/* Describe a function type as a signature string (for error messages) */
+static void describe_signature(hl_type_fun* tf, int first, char* buf, int size) {
+    int pos = 0;
+    for (int i = first; i < tf->nargs && pos < size - 3; i++) {
+        char c = typed_code(tf->args[i]);
+        buf[pos++] = c ? c : '?';
+    }
+    buf[pos++] = ':';
+    char r = typed_code(tf->ret);
+    buf[pos++] = r ? r : '?';
+    buf[pos] = 0;
+}
+
+/* Validate signature against function type (args from 'first', skipping this)
+ * and record it on the cache entry */
+static bool bind_signature(
+    hlffi_vm* vm,
+    hlffi_cached_call* cache,
+    hl_type_fun* tf,
+    int first,
+    const char* class_name,
+    const char* method_name,
+    const char* signature
+) {
+    const char* colon = strchr(signature, ':');
+    int nargs = colon ? (int)(colon - signature) : -1;
+
+    if (!colon || nargs > HLFFI_CACHE_TYPED_MAX_ARGS || strlen(colon + 1) != 1 ||
+        strspn(signature, "idbo") != (size_t)nargs || !strchr("vidb", colon[1])) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Invalid typed signature '%s' (expected up to %d of 'idbo', ':', one of 'vidb')",
+                 signature, HLFFI_CACHE_TYPED_MAX_ARGS);
+        return false;
+    }
+
+    bool match = (tf->nargs - first == nargs) && typed_code(tf->ret) == colon[1];
+    for (int i = 0; match && i < nargs; i++) {
+        match = typed_code(tf->args[first + i]) == signature[i];
+    }
+
+    if (!match) {
+        char actual[HLFFI_CACHE_TYPED_MAX_ARGS * 4 + 4];
+        describe_signature(tf, first, actual, sizeof(actual));
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Signature mismatch for '%s.%s': requested '%s', function is '%s'",
+                 class_name, method_name, signature, actual);
+        return false;
+    }
+
+    cache->typed = true;
+    cache->typed_nargs = nargs;
+    memcpy(cache->typed_args, signature, nargs);
+    cache->typed_args[nargs] = 0;
+    cache->typed_ret = colon[1];
+    cache->typed_string_args = 0;
+    for (int i = 0; i < nargs; i++) {
+        if (signature[i] == 'o' && is_string_type(tf->args[first + i])) {
+            cache->typed_string_args |= 1u << i;
+            cache->typed_string_type = tf->args[first + i];
+        }
+    }
+
+    return true;
+}
+
+hlffi_cached_call* hlffi_cache_static_method_typed(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* method_name,
+    const char* signature
+) {
+    if (!vm || !signature) {
+        if (vm) {
+            snprintf(vm->error_msg, sizeof(vm->error_msg),
+                     "NULL parameter in hlffi_cache_static_method_typed");
+        }
+        return NULL;
+    }
+
+    hlffi_cached_call* cache = hlffi_cache_static_method(vm, class_name, method_name);
+    if (!cache) {
+        return NULL;
+    }
+
+    if (!bind_signature(vm, cache, cache->closure->t->fun, 0, class_name, method_name, signature)) {
+        hlffi_cached_call_free(cache);
+        return NULL;
+    }
+
+    return cache;
+}
+
+hlffi_cached_call* hlffi_cache_instance_method_typed(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* method_name,
+    const char* signature
+) {
+    if (!vm || !signature) {
+        if (vm) {
+            snprintf(vm->error_msg, sizeof(vm->error_msg),
+                     "NULL parameter in hlffi_cache_instance_method_typed");
+        }
+        return NULL;
+    }
+
+    hlffi_cached_call* cache = hlffi_cache_instance_method(vm, class_name, method_name);
+    if (!cache) {
+        return NULL;
+    }
+
+    /* Method type includes 'this' as its first argument */
+    if (!bind_signature(vm, cache, cache->dispatch[0].ftype->fun, 1, class_name, method_name, signature)) {
+        hlffi_cached_call_free(cache);
+        return NULL;
+    }
+
+    return cache;
+}
+
+/* Raw argument slot: word-class (Int, Bool, pointer) or double */
+typedef union {
+    intptr_t w;
+    double d;
+} native_slot;
+
+/* Direct calls by (arity, double-mask): bit k of the mask set = argument k is a double */
+#define NATIVE_KEY(n, mask) (((n) << TYPED_MAX_NATIVE_ARGS) | (mask))
+
+#define T_0 intptr_t
+#define T_1 double
+#define A_0(k) a[k].w
+#define A_1(k) a[k].d
+
+#define CALL0(R) \
+    case NATIVE_KEY(0, 0): return ((R(*)(void))fun)();
+#define CALL1(R, x0) \
+    case NATIVE_KEY(1, x0): return ((R(*)(T_##x0))fun)(A_##x0(0));
+#define CALL2(R, x0, x1) \
+    case NATIVE_KEY(2, x0 | x1 << 1): \
+        return ((R(*)(T_##x0, T_##x1))fun)(A_##x0(0), A_##x1(1));
+#define CALL3(R, x0, x1, x2) \
+    case NATIVE_KEY(3, x0 | x1 << 1 | x2 << 2): \
+        return ((R(*)(T_##x0, T_##x1, T_##x2))fun)(A_##x0(0), A_##x1(1), A_##x2(2));
+#define CALL4(R, x0, x1, x2, x3) \
+    case NATIVE_KEY(4, x0 | x1 << 1 | x2 << 2 | x3 << 3): \
+        return ((R(*)(T_##x0, T_##x1, T_##x2, T_##x3))fun)(A_##x0(0), A_##x1(1), A_##x2(2), A_##x3(3));
+#define CALL5(R, x0, x1, x2, x3, x4) \
+    case NATIVE_KEY(5, x0 | x1 << 1 | x2 << 2 | x3 << 3 | x4 << 4): \
+        return ((R(*)(T_##x0, T_##x1, T_##x2, T_##x3, T_##x4))fun)(A_##x0(0), A_##x1(1), A_##x2(2), A_##x3(3), A_##x4(4));
+
+/* Expand M(R, ...) for every word/double combination of an arity */
+#define EACH1(M, R)                      M(R, 0) M(R, 1)
+#define EACH2(M, R)                      EACH2_(M, R, 0) EACH2_(M, R, 1)
+#define EACH2_(M, R, a)                  M(R, a, 0) M(R, a, 1)
+#define EACH3(M, R)                      EACH3_(M, R, 0) EACH3_(M, R, 1)
+#define EACH3_(M, R, a)                  EACH3__(M, R, a, 0) EACH3__(M, R, a, 1)
+#define EACH3__(M, R, a, b)              M(R, a, b, 0) M(R, a, b, 1)
+#define EACH4(M, R)                      EACH4_(M, R, 0) EACH4_(M, R, 1)
+#define EACH4_(M, R, a)                  EACH4__(M, R, a, 0) EACH4__(M, R, a, 1)
+#define EACH4__(M, R, a, b)              EACH4___(M, R, a, b, 0) EACH4___(M, R, a, b, 1)
+#define EACH4___(M, R, a, b, c)          M(R, a, b, c, 0) M(R, a, b, c, 1)
+#define EACH5(M, R)                      EACH5_(M, R, 0) EACH5_(M, R, 1)
+#define EACH5_(M, R, a)                  EACH5__(M, R, a, 0) EACH5__(M, R, a, 1)
+#define EACH5__(M, R, a, b)              EACH5___(M, R, a, b, 0) EACH5___(M, R, a, b, 1)
+#define EACH5___(M, R, a, b, c)          EACH5____(M, R, a, b, c, 0) EACH5____(M, R, a, b, c, 1)
+#define EACH5____(M, R, a, b, c, d)      M(R, a, b, c, d, 0) M(R, a, b, c, d, 1)
+
+#define NATIVE_CALL_CASES(R) \
+    CALL0(R) EACH1(CALL1, R) EACH2(CALL2, R) EACH3(CALL3, R) EACH4(CALL4, R) EACH5(CALL5, R)
+
+/* Word-returning calls (also used for Void: the return register is ignored) */
+static intptr_t native_call_w(void* fun, int key, native_slot* a) {
+    switch (key) {
+        NATIVE_CALL_CASES(intptr_t)
+    }
+    return 0;
+}
+
+static double native_call_d(void* fun, int key, native_slot* a) {
+    switch (key) {
+        NATIVE_CALL_CASES(double)
+    }
+    return 0.0;
+}
+
+/* Convert arguments, call with exception trap, convert result */
+static bool invoke_typed(
+    hlffi_cached_call* cached,
+    void* fun,
+    vdynamic* prefix,
+    bool has_prefix,
+    const hlffi_native_value* args,
+    hlffi_native_value* ret
+) {
+    native_slot a[TYPED_MAX_NATIVE_ARGS];
+    int n = 0;
+    int mask = 0;
+
+    if (has_prefix) {
+        a[n++].w = (intptr_t)prefix;
+    }
+
+    for (int i = 0; i < cached->typed_nargs; i++, n++) {
+        switch (cached->typed_args[i]) {
+            case 'i': a[n].w = (intptr_t)args[i].i; break;
+            case 'b': a[n].w = (intptr_t)args[i].b; break;
+            case 'd': a[n].d = args[i].d; mask |= 1 << n; break;
+            case 'o': {
+                vdynamic* v = args[i].o ? args[i].o->hl_value : NULL;
+                /* HBYTES from hlffi_value_string -> String object (see retag_string_args) */
+                if (v && (cached->typed_string_args & (1u << i)) && v->t->kind == HBYTES) {
+                    v->t = cached->typed_string_type;
+                }
+                a[n].w = (intptr_t)v;
+                break;
+            }
+        }
+    }
+
+    int key = NATIVE_KEY(n, mask);
+
+    HLFFI_UPDATE_STACK_TOP();
+
+    hl_trap_ctx trap;
+    vdynamic* exc = NULL;
+    hl_trap(trap, exc, on_exception);
+
+    if (cached->typed_ret == 'd') {
+        double r = native_call_d(fun, key, a);
+        if (ret) ret->d = r;
+    } else {
+        intptr_t r = native_call_w(fun, key, a);
+        if (ret) {
+            switch (cached->typed_ret) {
+                case 'i': ret->i = (int)r; break;
+                case 'b': ret->b = (unsigned char)r != 0; break;  /* HL bools are 8-bit */
+                default: break;
+            }
+        }
+    }
+
+    hl_endtrap(trap);
+    return true;
+
+on_exception:
+    if (cached->vm) {
+        hlffi_exception_capture(cached->vm, exc);
+        hlffi_set_error(cached->vm, HLFFI_ERROR_EXCEPTION_THROWN, "Exception thrown during typed cached call");
+    }
+    return false;
+}
+
+bool hlffi_call_cached_typed(
+    hlffi_cached_call* cached,
+    const hlffi_native_value* args,
+    hlffi_native_value* ret
+) {
+    if (!cached || !cached->closure || !cached->typed) {
+        return false;  /* Needs a handle from hlffi_cache_static_method_typed */
+    }
+    if (cached->typed_nargs > 0 && !args) {
+        return false;
+    }
+
+    if (!cached_call_current(cached)) {
+        return false;
+    }
+
+    vclosure* cl = cached->closure;
+    return invoke_typed(cached, cl->fun, (vdynamic*)cl->value, cl->hasValue != 0, args, ret);
+}
+
+bool hlffi_call_cached_method_typed(
+    hlffi_cached_call* cached,
+    hlffi_value* instance,
+    const hlffi_native_value* args,
+    hlffi_native_value* ret
+) {
+    if (!cached || !cached->class_type || !cached->typed) {
+        return false;  /* Needs a handle from hlffi_cache_instance_method_typed */
+    }
+    if (cached->typed_nargs > 0 && !args) {
+        return false;
+    }
+
+    if (!instance || !instance->hl_value || instance->hl_value->t->kind != HOBJ) {
+        hlffi_set_error(cached->vm, HLFFI_ERROR_NULL_VALUE, "Instance is NULL or not an object");
+        return false;
+    }
+
+    if (!cached_call_current(cached)) {
+        return false;
+    }
+
+    hlffi_cached_dispatch* d = find_dispatch(cached, instance->hl_value->t);
+    if (!d) {
+        hlffi_set_error(cached->vm, HLFFI_ERROR_TYPE_MISMATCH,
+                        "Instance is not of the cached class (or a subclass)");
+        return false;
+    }
+
+    return invoke_typed(cached, d->fun, instance->hl_value, true, args, ret);
+}
+
+/* ========== HOT RELOAD REVALIDATION ========== */
+
+/*
+ * A module patch can replace method implementations and change class
+ * layouts, so every handle is stamped with the module generation it was
+ * resolved in (vm->module_generation, bumped by each hot reload). Calls
+ * compare the stamp - one integer compare - and a stale handle re-resolves
+ * by name before running: once per handle per reload, no registry or host
+ * bookkeeping. If the member no longer resolves (removed, or no longer
+ * matching a typed handle's signature) the call fails with the reason in
+ * hlffi_get_error() and the handle stays stale, so a later reload that
+ * restores the member brings it back.
+ */
+
+/* Resolution helpers report through error_msg; tag the failure code */
+static bool refresh_failed(hlffi_vm* vm, hlffi_error_code code) {
+    vm->last_error = code;
+    return false;
+}
+
+/* Re-check a typed handle's signature against the re-resolved function type */
+static bool rebind_signature(hlffi_cached_call* cached, hl_type_fun* tf, int first) {
+    char signature[HLFFI_CACHE_TYPED_MAX_ARGS + 3];
+    snprintf(signature, sizeof(signature), "%s:%c", cached->typed_args, cached->typed_ret);
+    return bind_signature(cached->vm, cached, tf, first, cached->class_name, cached->method_name, signature);
+}
+
+static bool refresh_cached_call(hlffi_cached_call* cached) {
+    hlffi_vm* vm = cached->vm;
+
+    if (cached->class_type) {
+        /* Instance method: re-resolve for the class, drop per-type dispatch */
+        hl_type* class_type = (hl_type*)hlffi_find_type(vm, cached->class_name);
+        hlffi_cached_dispatch resolved;
+        if (!class_type || class_type->kind != HOBJ || !class_type->obj ||
+            !resolve_dispatch(class_type, cached->method_hash, &resolved)) {
+            snprintf(vm->error_msg, sizeof(vm->error_msg),
+                     "Instance method '%s' not found in class '%s' after reload",
+                     cached->method_name, cached->class_name);
+            return refresh_failed(vm, HLFFI_ERROR_METHOD_NOT_FOUND);
+        }
+        if (cached->typed && !rebind_signature(cached, resolved.ftype->fun, 1)) {
+            return refresh_failed(vm, HLFFI_ERROR_TYPE_MISMATCH);
+        }
+
+        cached->class_type = class_type;
+        cached->nargs = resolved.ftype->fun->nargs - 1;
+        cached->dispatch[0] = resolved;
+        cached->dispatch_count = 1;
+        cached->dispatch_next = 0;
+    } else {
+        /* Static method: fetch the (possibly new) closure; the root is on
+         * &cached->closure, so it covers the new value */
+        vclosure* closure = resolve_static_closure(vm, cached->class_name, cached->method_name);
+        if (!closure) {
+            return refresh_failed(vm, HLFFI_ERROR_METHOD_NOT_FOUND);
+        }
+        if (cached->typed && !rebind_signature(cached, closure->t->fun, 0)) {
+            return refresh_failed(vm, HLFFI_ERROR_TYPE_MISMATCH);
+        }
+
+        cached->closure = closure;
+        cached->string_args = string_arg_mask(closure->t->fun);
+    }
+
+    cached->generation = vm->module_generation;
+    return true;
+}
+
+/* ========== CACHED FIELD ACCESS ========== */
+
+/*
+ * Instance fields live at a fixed byte offset in the object. Subclasses
+ * extend their parent's layout, so the offset resolved for the class holds
+ * for every subclass instance too. The handle keeps the offset and field
+ * type; accessors check the receiver type (pointer compare against the last
+ * verified type) and read/write the object memory directly.
+ */
+
+struct hlffi_cached_field {
+    hlffi_vm* vm;               /* For error reporting */
+    hl_type* class_type;        /* Class the field was cached for */
+    hl_type* field_type;        /* Declared field type */
+    int offset;                 /* Byte offset from the object start */
+    hl_type* last_type;         /* Last receiver type verified against class_type */
+    char* class_name;           /* Names to re-resolve by after hot reload */
+    char* field_name;
+    unsigned generation;        /* Module generation the offset belongs to */
+};
+
+/* Scalar kinds supported by the typed accessors */
+static bool is_cacheable_field_kind(hl_type_kind kind) {
+    switch (kind) {
+        case HI32: case HUI8: case HUI16:
+        case HF64: case HF32:
+        case HBOOL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Resolve a scalar instance field (at cache time and after reload) */
+static hl_field_lookup* resolve_field(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* field_name,
+    hl_type** class_type_out
+) {
+    HLFFI_UPDATE_STACK_TOP();
+
+    /* 1. Find class type */
+    hl_type* class_type = hlffi_type_index_lookup_class(vm, class_name);
+    if (!class_type || class_type->kind != HOBJ || !class_type->obj) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Class '%s' not found", class_name);
+        return NULL;
+    }
+
+    /* 2. Resolve field offset (runtime layout is built on first use) */
+    if (!hl_get_obj_rt(class_type)) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Class '%s' has no runtime layout", class_name);
+        return NULL;
+    }
+
+    hl_field_lookup* lookup = obj_resolve_field(class_type->obj, hl_hash_utf8(field_name));
+    if (!lookup) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Field '%s' not found in class '%s'", field_name, class_name);
+        return NULL;
+    }
+
+    /* Negative field_index is a method, not a data field */
+    if (lookup->field_index < 0) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "'%s.%s' is a method, not a field", class_name, field_name);
+        return NULL;
+    }
+
+    if (!lookup->t || !is_cacheable_field_kind(lookup->t->kind)) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Field '%s.%s' is not an Int/Float/Bool field (kind=%d) - use hlffi_get_field()",
+                 class_name, field_name, lookup->t ? lookup->t->kind : -1);
+        return NULL;
+    }
+
+    *class_type_out = class_type;
+    return lookup;
+}
+
+hlffi_cached_field* hlffi_cache_field(
+    hlffi_vm* vm,
+    const char* class_name,
+    const char* field_name
+) {
+    if (!vm || !class_name || !field_name) {
+        if (vm) {
+            snprintf(vm->error_msg, sizeof(vm->error_msg),
+                     "NULL parameter in hlffi_cache_field");
+        }
+        return NULL;
+    }
+
+    hl_type* class_type = NULL;
+    hl_field_lookup* lookup = resolve_field(vm, class_name, field_name, &class_type);
+    if (!lookup) {
+        return NULL;
+    }
+
+    /* 3. Create cache entry */
+    hlffi_cached_field* cache = (hlffi_cached_field*)calloc(1, sizeof(hlffi_cached_field));
+    if (cache) {
+        cache->class_name = strdup(class_name);
+        cache->field_name = strdup(field_name);
+        if (!cache->class_name || !cache->field_name) {
+            hlffi_cached_field_free(cache);
+            cache = NULL;
+        }
+    }
+    if (!cache) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Failed to allocate cache entry");
+        return NULL;
+    }
+
+    cache->vm = vm;
+    cache->class_type = class_type;
+    cache->field_type = lookup->t;
+    cache->offset = lookup->field_index;
+    cache->last_type = class_type;
+    cache->generation = vm->module_generation;
+
+    return cache;
+}
+
+/* Re-resolve a field handle after a module patch (layout may have changed) */
+static bool refresh_cached_field(hlffi_cached_field* field) {
+    hlffi_vm* vm = field->vm;
+
+    hl_type* class_type = NULL;
+    hl_field_lookup* lookup = resolve_field(vm, field->class_name, field->field_name, &class_type);
+    if (!lookup) {
+        return refresh_failed(vm, HLFFI_ERROR_FIELD_NOT_FOUND);
+    }
+
+    field->class_type = class_type;
+    field->field_type = lookup->t;
+    field->offset = lookup->field_index;
+    field->last_type = class_type;
+    field->generation = vm->module_generation;
+    return true;
+}
+
+static inline bool cached_field_current(hlffi_cached_field* field) {
+    return field->generation == field->vm->module_generation || refresh_cached_field(field);
+}
+
+hlffi_type* hlffi_cached_field_type(const hlffi_cached_field* field) {
+    return field ? (hlffi_type*)field->field_type : NULL;
+}
+
+/* Check receiver type t against the cached class (pointer compare on the
+ * last verified type, subclass walk on change) */
+static inline bool cached_field_accepts(hlffi_cached_field* field, hl_type* t) {
+    if (t == field->last_type) return true;
+    if (!is_same_or_subclass(t, field->class_type)) return false;
+    field->last_type = t;
+    return true;
+}
+
+/* Address of the field in obj, or NULL if obj is not of the cached class */
+static char* cached_field_addr(hlffi_cached_field* field, hlffi_value* obj) {
+    if (!field) return NULL;
+
+    if (!obj || !obj->hl_value) {
+        hlffi_set_error(field->vm, HLFFI_ERROR_NULL_VALUE, "Instance is NULL");
+        return NULL;
+    }
+
+    if (!cached_field_current(field)) {
+        return NULL;
+    }
+
+    vdynamic* o = obj->hl_value;
+    if (!cached_field_accepts(field, o->t)) {
+        hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH,
+                        "Instance is not of the cached class (or a subclass)");
+        return NULL;
+    }
+
+    return (char*)o + field->offset;
+}
+
+int hlffi_cached_field_get_int(hlffi_cached_field* field, hlffi_value* obj, int fallback) {
+    char* addr = cached_field_addr(field, obj);
+    if (!addr) return fallback;
+
+    switch (field->field_type->kind) {
+        case HI32:  return *(int*)addr;
+        case HUI8:  return *(unsigned char*)addr;
+        case HUI16: return *(unsigned short*)addr;
+        default:
+            hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH, "Cached field is not an Int field");
+            return fallback;
+    }
+}
+
+double hlffi_cached_field_get_float(hlffi_cached_field* field, hlffi_value* obj, double fallback) {
+    char* addr = cached_field_addr(field, obj);
+    if (!addr) return fallback;
+
+    switch (field->field_type->kind) {
+        case HF64: return *(double*)addr;
+        case HF32: return *(float*)addr;
+        default:
+            hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH, "Cached field is not a Float field");
+            return fallback;
+    }
+}
+
+bool hlffi_cached_field_get_bool(hlffi_cached_field* field, hlffi_value* obj, bool fallback) {
+    char* addr = cached_field_addr(field, obj);
+    if (!addr) return fallback;
+
+    if (field->field_type->kind != HBOOL) {
+        hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH, "Cached field is not a Bool field");
+        return fallback;
+    }
+    return *(bool*)addr;
+}
+
+bool hlffi_cached_field_set_int(hlffi_cached_field* field, hlffi_value* obj, int value) {
+    char* addr = cached_field_addr(field, obj);
+    if (!addr) return false;
+
+    switch (field->field_type->kind) {
+        case HI32:  *(int*)addr = value; return true;
+        case HUI8:  *(unsigned char*)addr = (unsigned char)value; return true;
+        case HUI16: *(unsigned short*)addr = (unsigned short)value; return true;
+        default:
+            hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH, "Cached field is not an Int field");
+            return false;
+    }
+}
+
+bool hlffi_cached_field_set_float(hlffi_cached_field* field, hlffi_value* obj, double value) {
+    char* addr = cached_field_addr(field, obj);
+    if (!addr) return false;
+
+    switch (field->field_type->kind) {
+        case HF64: *(double*)addr = value; return true;
+        case HF32: *(float*)addr = (float)value; return true;
+        default:
+            hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH, "Cached field is not a Float field");
+            return false;
+    }
+}
+
+bool hlffi_cached_field_set_bool(hlffi_cached_field* field, hlffi_value* obj, bool value) {
+    char* addr = cached_field_addr(field, obj);
+    if (!addr) return false;
+
+    if (field->field_type->kind != HBOOL) {
+        hlffi_set_error(field->vm, HLFFI_ERROR_TYPE_MISMATCH, "Cached field is not a Bool field");
+        return false;
+    }
+    *(bool*)addr = value;
+    return true;
+}
+
+void hlffi_cached_field_free(hlffi_cached_field* field) {
+    /* Types and offsets are not GC-managed - nothing to unroot */
+    if (!field) return;
+    free(field->class_name);
+    free(field->field_name);
+    free(field);
+}
+
+/* ========== BULK FIELD SYNC (STRUCT OF ARRAYS) ========== */
+
+/*
+ * Copies cached fields of every object in an array to/from contiguous C
+ * columns in one pass: one array resolution per call, one type check per
+ * object and column (pointer compare), direct loads/stores at the cached
+ * offsets. Columns whose C type matches the field representation are copied
+ * as-is; others (e.g. Float field -> float column) are converted.
+ */
+
+static int column_elem_size(hlffi_type_kind type) {
+    switch (type) {
+        case HLFFI_TYPE_I32:  return sizeof(int32_t);
+        case HLFFI_TYPE_F32:  return sizeof(float);
+        case HLFFI_TYPE_F64:  return sizeof(double);
+        case HLFFI_TYPE_BOOL: return sizeof(bool);
+        default:              return 0;
+    }
+}
+
+/* Field and column share the same representation: plain copy */
+static bool column_is_native(hl_type_kind kind, hlffi_type_kind type) {
+    return (kind == HI32 && type == HLFFI_TYPE_I32) ||
+           (kind == HF32 && type == HLFFI_TYPE_F32) ||
+           (kind == HF64 && type == HLFFI_TYPE_F64) ||
+           (kind == HBOOL && type == HLFFI_TYPE_BOOL);
+}
+
+static double field_load(hl_type_kind kind, const char* addr) {
+    switch (kind) {
+        case HI32:  return *(const int*)addr;
+        case HUI8:  return *(const unsigned char*)addr;
+        case HUI16: return *(const unsigned short*)addr;
+        case HF64:  return *(const double*)addr;
+        case HF32:  return *(const float*)addr;
+        case HBOOL: return *(const bool*)addr ? 1.0 : 0.0;
+        default:    return 0.0;
+    }
+}
+
+static void field_store(hl_type_kind kind, char* addr, double v) {
+    switch (kind) {
+        case HI32:  *(int*)addr = (int)v; break;
+        case HUI8:  *(unsigned char*)addr = (unsigned char)(int)v; break;
+        case HUI16: *(unsigned short*)addr = (unsigned short)(int)v; break;
+        case HF64:  *(double*)addr = v; break;
+        case HF32:  *(float*)addr = (float)v; break;
+        case HBOOL: *(bool*)addr = (v != 0.0); break;
+        default:    break;
+    }
+}
+
+static double column_load(hlffi_type_kind type, const char* slot) {
+    switch (type) {
+        case HLFFI_TYPE_I32:  return *(const int32_t*)slot;
+        case HLFFI_TYPE_F32:  return *(const float*)slot;
+        case HLFFI_TYPE_F64:  return *(const double*)slot;
+        case HLFFI_TYPE_BOOL: return *(const bool*)slot ? 1.0 : 0.0;
+        default:              return 0.0;
+    }
+}
+
+static void column_store(hlffi_type_kind type, char* slot, double v) {
+    switch (type) {
+        case HLFFI_TYPE_I32:  *(int32_t*)slot = (int32_t)v; break;
+        case HLFFI_TYPE_F32:  *(float*)slot = (float)v; break;
+        case HLFFI_TYPE_F64:  *(double*)slot = v; break;
+        case HLFFI_TYPE_BOOL: *(bool*)slot = (v != 0.0); break;
+        default:              break;
+    }
+}
+
+/* Fixed-size copy for native columns (sizes 1, 4 or 8) */
+static inline void copy_native(char* dst, const char* src, int size) {
+    switch (size) {
+        case 8: memcpy(dst, src, 8); break;
+        case 4: memcpy(dst, src, 4); break;
+        default: *dst = *src; break;
+    }
+}
+
+/* Validate columns and resolve the object array; returns element count or -1 */
+static int bulk_prepare(
+    hlffi_vm* vm,
+    hlffi_value* objects,
+    const hlffi_field_column* columns,
+    int ncolumns,
+    vdynamic*** elements,
+    int* sizes,
+    bool* native
+) {
+    if (!objects || !objects->hl_value || (ncolumns > 0 && !columns) || ncolumns < 0) {
+        hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "NULL array or columns");
+        return -1;
+    }
+
+    for (int c = 0; c < ncolumns; c++) {
+        sizes[c] = column_elem_size(columns[c].type);
+        if (!columns[c].field || !columns[c].data || sizes[c] == 0) {
+            hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT,
+                            "Column needs a field handle, a buffer and an I32/F32/F64/BOOL type");
+            return -1;
+        }
+        if (!cached_field_current(columns[c].field)) {
+            return -1;
+        }
+        native[c] = column_is_native(columns[c].field->field_type->kind, columns[c].type);
+    }
+
+    int count = 0;
+    if (!hlffi_array_object_elements(objects->hl_value, elements, &count)) {
+        hlffi_set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array of objects");
+        return -1;
+    }
+    return count;
+}
+
+int hlffi_array_gather_fields(
+    hlffi_vm* vm,
+    hlffi_value* objects,
+    const hlffi_field_column* columns,
+    int ncolumns,
+    int max_count
+) {
+    if (!vm) return -1;
+
+    int* sizes = (int*)alloca((ncolumns > 0 ? ncolumns : 1) * sizeof(int));
+    bool* native = (bool*)alloca((ncolumns > 0 ? ncolumns : 1) * sizeof(bool));
+    vdynamic** elements = NULL;
+    int count = bulk_prepare(vm, objects, columns, ncolumns, &elements, sizes, native);
+    if (count < 0) return -1;
+    if (max_count >= 0 && count > max_count) count = max_count;
+
+    for (int i = 0; i < count; i++) {
+        vdynamic* o = elements[i];
+
+        for (int c = 0; c < ncolumns; c++) {
+            const hlffi_field_column* col = &columns[c];
+            char* slot = (char*)col->data + (size_t)i * sizes[c];
+
+            /* Null elements read as zero */
+            if (!o) {
+                memset(slot, 0, sizes[c]);
+                continue;
+            }
+
+            hlffi_cached_field* field = col->field;
+            if (!cached_field_accepts(field, o->t)) {
+                hlffi_set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                                "Array element is not of the cached field's class (or a subclass)");
+                return -1;
+            }
+
+            const char* addr = (const char*)o + field->offset;
+            if (native[c]) {
+                copy_native(slot, addr, sizes[c]);
+            } else {
+                column_store(col->type, slot, field_load(field->field_type->kind, addr));
+            }
+        }
+    }
+
+    return count;
+}
+
+int hlffi_array_scatter_fields(
+    hlffi_vm* vm,
+    hlffi_value* objects,
+    const hlffi_field_column* columns,
+    int ncolumns,
+    int count
+) {
+    if (!vm) return -1;
+
+    int* sizes = (int*)alloca((ncolumns > 0 ? ncolumns : 1) * sizeof(int));
+    bool* native = (bool*)alloca((ncolumns > 0 ? ncolumns : 1) * sizeof(bool));
+    vdynamic** elements = NULL;
+    int length = bulk_prepare(vm, objects, columns, ncolumns, &elements, sizes, native);
+    if (length < 0) return -1;
+    if (count < 0 || count > length) count = length;
+
+    for (int i = 0; i < count; i++) {
+        vdynamic* o = elements[i];
+        if (!o) continue;  /* Null elements are skipped */
+
+        for (int c = 0; c < ncolumns; c++) {
+            const hlffi_field_column* col = &columns[c];
+            const char* slot = (const char*)col->data + (size_t)i * sizes[c];
+
+            hlffi_cached_field* field = col->field;
+            if (!cached_field_accepts(field, o->t)) {
+                hlffi_set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                                "Array element is not of the cached field's class (or a subclass)");
+                return -1;
+            }
+
+            char* addr = (char*)o + field->offset;
+            if (native[c]) {
+                copy_native(addr, slot, sizes[c]);
+            } else {
+                field_store(field->field_type->kind, addr, column_load(col->type, slot));
+            }
+        }
+    }
+
+    return count;
 }
@@ -5,6 +5,7 @@
 
 #include "hlffi_internal.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -20,120 +21,259 @@ static void set_error(hlffi_vm* vm, const char* msg) {
     }
 }
 
-/* Store exception information from vdynamic */
-static void store_exception(hlffi_vm* vm, vdynamic* exception) {
-    if (!vm || !exception) return;
-
-    /* Get exception as string */
-    uchar* exc_str = hl_to_string(exception);
-    if (exc_str) {
-        char* utf8_msg = hl_to_utf8(exc_str);
-        if (utf8_msg) {
-            strncpy(vm->exception_msg, utf8_msg, sizeof(vm->exception_msg) - 1);
-            vm->exception_msg[sizeof(vm->exception_msg) - 1] = '\0';
-        }
-    }
-
-    /* Get stack trace using hl_print_uncaught_exception output */
-    /* For now, just store the message - full stack trace requires more work */
-    snprintf(vm->exception_stack, sizeof(vm->exception_stack),
-             "Exception: %s\n(Full stack trace not yet implemented)",
-             vm->exception_msg);
-}
-
-/* Helper: Convert vdynamic** args to hlffi_value** */
-static hlffi_value** convert_args(hlffi_vm* vm, vdynamic** hl_args, int nargs) {
-    if (nargs == 0) return NULL;
-
-    hlffi_value** hlffi_args = (hlffi_value**)malloc(nargs * sizeof(hlffi_value*));
-    if (!hlffi_args) return NULL;
+/* Invoke the C callback with a stack-resident view of the Haxe arguments.
+ * The hlffi_value wrappers and the argv array live in this frame, so a
+ * callback invocation does no heap allocation; argv is only valid during
+ * the call (callbacks that keep a value must copy or root it). */
+static vdynamic* dispatch_callback(hlffi_callback_entry* entry, int nargs, vdynamic** hl_args) {
+    if (!entry || !entry->c_func || !entry->vm) return NULL;
 
+    struct hlffi_value values[HLFFI_MAX_CALLBACK_ARGS];
+    hlffi_value* argv[HLFFI_MAX_CALLBACK_ARGS];
     for (int i = 0; i < nargs; i++) {
-        hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
-        if (!wrapped) {
-            /* Cleanup on allocation failure */
-            for (int j = 0; j < i; j++) {
-                free(hlffi_args[j]);
-            }
-            free(hlffi_args);
-            return NULL;
-        }
-        wrapped->hl_value = hl_args[i];
-        wrapped->is_rooted = false;  /* Don't root args - they're temporary */
-        hlffi_args[i] = wrapped;
+        values[i].hl_value = hl_args[i];
+        values[i].is_rooted = false;  /* Args are owned by the Haxe caller's frame */
+        values[i].in_scope = false;
+        argv[i] = &values[i];
     }
-    return hlffi_args;
-}
 
-/* Helper: Free converted args */
-static void free_args(hlffi_value** args, int nargs) {
-    if (!args) return;
-    for (int i = 0; i < nargs; i++) {
-        free(args[i]);
-    }
-    free(args);
+    hlffi_value* result = entry->c_func(entry->vm, nargs, nargs > 0 ? argv : NULL);
+    return result ? result->hl_value : NULL;
 }
 
 /* Native function wrappers - bridge C callback to HashLink calling conventions
  * HashLink uses specific calling conventions: fun(arg1, arg2, ...) not fun(closure, args[])
- * We need separate wrappers for each arity (0-4 args) */
+ * so there is one wrapper per arity (0 to HLFFI_MAX_CALLBACK_ARGS). */
 
 static vdynamic* native_wrapper0(hlffi_callback_entry* entry) {
-    if (!entry || !entry->c_func || !entry->vm) return NULL;
-    hlffi_value* result = entry->c_func(entry->vm, 0, NULL);
-    return result ? result->hl_value : NULL;
+    return dispatch_callback(entry, 0, NULL);
 }
 
-static vdynamic* native_wrapper1(hlffi_callback_entry* entry, vdynamic* a0) {
-    if (!entry || !entry->c_func || !entry->vm) return NULL;
-    vdynamic* hl_args[] = {a0};
-    hlffi_value** args = convert_args(entry->vm, hl_args, 1);
-    if (!args) return NULL;
-    hlffi_value* result = entry->c_func(entry->vm, 1, args);
-    free_args(args, 1);
-    return result ? result->hl_value : NULL;
+#define NATIVE_WRAPPER(n, params, args) \
+    static vdynamic* native_wrapper##n(hlffi_callback_entry* entry params) { \
+        vdynamic* hl_args[] = { args }; \
+        return dispatch_callback(entry, n, hl_args); \
+    }
+
+/* Parameter and argument lists: WRAPPER_PARAMS_n = ", vdynamic* a0, ..., vdynamic* a(n-1)" */
+#define WRAPPER_PARAMS_1  , vdynamic* a0
+#define WRAPPER_PARAMS_2  WRAPPER_PARAMS_1, vdynamic* a1
+#define WRAPPER_PARAMS_3  WRAPPER_PARAMS_2, vdynamic* a2
+#define WRAPPER_PARAMS_4  WRAPPER_PARAMS_3, vdynamic* a3
+#define WRAPPER_PARAMS_5  WRAPPER_PARAMS_4, vdynamic* a4
+#define WRAPPER_PARAMS_6  WRAPPER_PARAMS_5, vdynamic* a5
+#define WRAPPER_PARAMS_7  WRAPPER_PARAMS_6, vdynamic* a6
+#define WRAPPER_PARAMS_8  WRAPPER_PARAMS_7, vdynamic* a7
+#define WRAPPER_PARAMS_9  WRAPPER_PARAMS_8, vdynamic* a8
+#define WRAPPER_PARAMS_10 WRAPPER_PARAMS_9, vdynamic* a9
+#define WRAPPER_PARAMS_11 WRAPPER_PARAMS_10, vdynamic* a10
+#define WRAPPER_PARAMS_12 WRAPPER_PARAMS_11, vdynamic* a11
+#define WRAPPER_PARAMS_13 WRAPPER_PARAMS_12, vdynamic* a12
+#define WRAPPER_PARAMS_14 WRAPPER_PARAMS_13, vdynamic* a13
+#define WRAPPER_PARAMS_15 WRAPPER_PARAMS_14, vdynamic* a14
+#define WRAPPER_PARAMS_16 WRAPPER_PARAMS_15, vdynamic* a15
+
+#define WRAPPER_ARGS_1  a0
+#define WRAPPER_ARGS_2  WRAPPER_ARGS_1, a1
+#define WRAPPER_ARGS_3  WRAPPER_ARGS_2, a2
+#define WRAPPER_ARGS_4  WRAPPER_ARGS_3, a3
+#define WRAPPER_ARGS_5  WRAPPER_ARGS_4, a4
+#define WRAPPER_ARGS_6  WRAPPER_ARGS_5, a5
+#define WRAPPER_ARGS_7  WRAPPER_ARGS_6, a6
+#define WRAPPER_ARGS_8  WRAPPER_ARGS_7, a7
+#define WRAPPER_ARGS_9  WRAPPER_ARGS_8, a8
+#define WRAPPER_ARGS_10 WRAPPER_ARGS_9, a9
+#define WRAPPER_ARGS_11 WRAPPER_ARGS_10, a10
+#define WRAPPER_ARGS_12 WRAPPER_ARGS_11, a11
+#define WRAPPER_ARGS_13 WRAPPER_ARGS_12, a12
+#define WRAPPER_ARGS_14 WRAPPER_ARGS_13, a13
+#define WRAPPER_ARGS_15 WRAPPER_ARGS_14, a14
+#define WRAPPER_ARGS_16 WRAPPER_ARGS_15, a15
+
+NATIVE_WRAPPER(1, WRAPPER_PARAMS_1, WRAPPER_ARGS_1)
+NATIVE_WRAPPER(2, WRAPPER_PARAMS_2, WRAPPER_ARGS_2)
+NATIVE_WRAPPER(3, WRAPPER_PARAMS_3, WRAPPER_ARGS_3)
+NATIVE_WRAPPER(4, WRAPPER_PARAMS_4, WRAPPER_ARGS_4)
+NATIVE_WRAPPER(5, WRAPPER_PARAMS_5, WRAPPER_ARGS_5)
+NATIVE_WRAPPER(6, WRAPPER_PARAMS_6, WRAPPER_ARGS_6)
+NATIVE_WRAPPER(7, WRAPPER_PARAMS_7, WRAPPER_ARGS_7)
+NATIVE_WRAPPER(8, WRAPPER_PARAMS_8, WRAPPER_ARGS_8)
+NATIVE_WRAPPER(9, WRAPPER_PARAMS_9, WRAPPER_ARGS_9)
+NATIVE_WRAPPER(10, WRAPPER_PARAMS_10, WRAPPER_ARGS_10)
+NATIVE_WRAPPER(11, WRAPPER_PARAMS_11, WRAPPER_ARGS_11)
+NATIVE_WRAPPER(12, WRAPPER_PARAMS_12, WRAPPER_ARGS_12)
+NATIVE_WRAPPER(13, WRAPPER_PARAMS_13, WRAPPER_ARGS_13)
+NATIVE_WRAPPER(14, WRAPPER_PARAMS_14, WRAPPER_ARGS_14)
+NATIVE_WRAPPER(15, WRAPPER_PARAMS_15, WRAPPER_ARGS_15)
+NATIVE_WRAPPER(16, WRAPPER_PARAMS_16, WRAPPER_ARGS_16)
+
+_Static_assert(HLFFI_MAX_CALLBACK_ARGS == 16, "one native_wrapperN is needed per supported arity");
+
+static void* const native_wrappers[HLFFI_MAX_CALLBACK_ARGS + 1] = {
+    (void*)native_wrapper0,  (void*)native_wrapper1,  (void*)native_wrapper2,
+    (void*)native_wrapper3,  (void*)native_wrapper4,  (void*)native_wrapper5,
+    (void*)native_wrapper6,  (void*)native_wrapper7,  (void*)native_wrapper8,
+    (void*)native_wrapper9,  (void*)native_wrapper10, (void*)native_wrapper11,
+    (void*)native_wrapper12, (void*)native_wrapper13, (void*)native_wrapper14,
+    (void*)native_wrapper15, (void*)native_wrapper16
+};
+
+/* Get wrapper function for given arity */
+static void* get_wrapper_for_arity(int nargs) {
+    if (nargs < 0 || nargs > HLFFI_MAX_CALLBACK_ARGS) return NULL;
+    return native_wrappers[nargs];
 }
 
-static vdynamic* native_wrapper2(hlffi_callback_entry* entry, vdynamic* a0, vdynamic* a1) {
-    if (!entry || !entry->c_func || !entry->vm) return NULL;
-    vdynamic* hl_args[] = {a0, a1};
-    hlffi_value** args = convert_args(entry->vm, hl_args, 2);
-    if (!args) return NULL;
-    hlffi_value* result = entry->c_func(entry->vm, 2, args);
-    free_args(args, 2);
-    return result ? result->hl_value : NULL;
+/* ========== TYPED WRAPPERS ========== */
+
+/* Typed callbacks receive Int/Float/Bool as raw values rather than vdynamic*,
+ * so the wrapper's C signature must match the closure's hl_type_fun. Wrappers
+ * are selected by register class rather than by exact Haxe type: Int, Bool,
+ * String and Dynamic arguments are all passed in integer registers / word-sized
+ * stack slots (W, read back as intptr_t and narrowed), Float arguments in
+ * floating-point registers (F, double). That keeps the generated set at
+ * 2^(n+1) wrappers per arity instead of one per type combination. */
+
+typedef union {
+    intptr_t w;
+    double f;
+} typed_slot;
+
+/* Present raw arguments to the C callback as stack-resident HI32/HF64/HBOOL
+ * values: no boxing on the Haxe side, no allocation on the C side. */
+static hlffi_value* dispatch_typed(hlffi_callback_entry* entry, int nargs, const typed_slot* slots) {
+    vdynamic boxes[HLFFI_MAX_TYPED_CALLBACK_ARGS];
+    struct hlffi_value values[HLFFI_MAX_TYPED_CALLBACK_ARGS];
+    hlffi_value* argv[HLFFI_MAX_TYPED_CALLBACK_ARGS];
+
+    for (int i = 0; i < nargs; i++) {
+        values[i].is_rooted = false;
+        values[i].in_scope = false;
+        argv[i] = &values[i];
+        switch (entry->arg_types[i]) {
+            case HLFFI_ARG_INT:
+                boxes[i].t = &hlt_i32;
+                boxes[i].v.i = (int)slots[i].w;
+                values[i].hl_value = &boxes[i];
+                break;
+            case HLFFI_ARG_FLOAT:
+                boxes[i].t = &hlt_f64;
+                boxes[i].v.d = slots[i].f;
+                values[i].hl_value = &boxes[i];
+                break;
+            case HLFFI_ARG_BOOL:
+                boxes[i].t = &hlt_bool;
+                boxes[i].v.b = (unsigned char)slots[i].w != 0;  /* Only the low byte is defined */
+                values[i].hl_value = &boxes[i];
+                break;
+            default:
+                values[i].hl_value = (vdynamic*)slots[i].w;
+                break;
+        }
+    }
+
+    return entry->c_func(entry->vm, nargs, nargs > 0 ? argv : NULL);
 }
 
-static vdynamic* native_wrapper3(hlffi_callback_entry* entry, vdynamic* a0, vdynamic* a1, vdynamic* a2) {
-    if (!entry || !entry->c_func || !entry->vm) return NULL;
-    vdynamic* hl_args[] = {a0, a1, a2};
-    hlffi_value** args = convert_args(entry->vm, hl_args, 3);
-    if (!args) return NULL;
-    hlffi_value* result = entry->c_func(entry->vm, 3, args);
-    free_args(args, 3);
-    return result ? result->hl_value : NULL;
+static intptr_t typed_result_W(hlffi_callback_entry* entry, hlffi_value* result) {
+    switch (entry->return_type) {
+        case HLFFI_ARG_VOID:  return 0;
+        case HLFFI_ARG_INT:   return hlffi_value_as_int(result, 0);
+        case HLFFI_ARG_BOOL:  return hlffi_value_as_bool(result, false) ? 1 : 0;
+        default:              return result ? (intptr_t)result->hl_value : 0;
+    }
 }
 
-static vdynamic* native_wrapper4(hlffi_callback_entry* entry, vdynamic* a0, vdynamic* a1, vdynamic* a2, vdynamic* a3) {
-    if (!entry || !entry->c_func || !entry->vm) return NULL;
-    vdynamic* hl_args[] = {a0, a1, a2, a3};
-    hlffi_value** args = convert_args(entry->vm, hl_args, 4);
-    if (!args) return NULL;
-    hlffi_value* result = entry->c_func(entry->vm, 4, args);
-    free_args(args, 4);
-    return result ? result->hl_value : NULL;
+static double typed_result_F(hlffi_callback_entry* entry, hlffi_value* result) {
+    (void)entry;
+    return hlffi_value_as_float(result, 0.0);
 }
 
-/* Get wrapper function for given arity */
-static void* get_wrapper_for_arity(int nargs) {
-    switch (nargs) {
-        case 0: return (void*)native_wrapper0;
-        case 1: return (void*)native_wrapper1;
-        case 2: return (void*)native_wrapper2;
-        case 3: return (void*)native_wrapper3;
-        case 4: return (void*)native_wrapper4;
-        default: return NULL;  /* >4 args not supported yet */
+#define TYPED_C_W intptr_t
+#define TYPED_C_F double
+#define TYPED_SLOT_W w
+#define TYPED_SLOT_F f
+
+#define TYPED_BODY(r, n, stores) \
+    typed_slot s[n]; stores \
+    return typed_result_##r(entry, dispatch_typed(entry, n, s));
+
+#define TYPED_WRAPPER0(r) \
+    static TYPED_C_##r typed_##r##_(hlffi_callback_entry* entry) { \
+        return typed_result_##r(entry, dispatch_typed(entry, 0, NULL)); }
+#define TYPED_WRAPPER1(r, a) \
+    static TYPED_C_##r typed_##r##_##a(hlffi_callback_entry* entry, TYPED_C_##a x0) { \
+        TYPED_BODY(r, 1, s[0].TYPED_SLOT_##a = x0;) }
+#define TYPED_WRAPPER2(r, a, b) \
+    static TYPED_C_##r typed_##r##_##a##b(hlffi_callback_entry* entry, TYPED_C_##a x0, TYPED_C_##b x1) { \
+        TYPED_BODY(r, 2, s[0].TYPED_SLOT_##a = x0; s[1].TYPED_SLOT_##b = x1;) }
+#define TYPED_WRAPPER3(r, a, b, c) \
+    static TYPED_C_##r typed_##r##_##a##b##c(hlffi_callback_entry* entry, TYPED_C_##a x0, TYPED_C_##b x1, \
+                                             TYPED_C_##c x2) { \
+        TYPED_BODY(r, 3, s[0].TYPED_SLOT_##a = x0; s[1].TYPED_SLOT_##b = x1; s[2].TYPED_SLOT_##c = x2;) }
+#define TYPED_WRAPPER4(r, a, b, c, d) \
+    static TYPED_C_##r typed_##r##_##a##b##c##d(hlffi_callback_entry* entry, TYPED_C_##a x0, TYPED_C_##b x1, \
+                                                TYPED_C_##c x2, TYPED_C_##d x3) { \
+        TYPED_BODY(r, 4, s[0].TYPED_SLOT_##a = x0; s[1].TYPED_SLOT_##b = x1; s[2].TYPED_SLOT_##c = x2; \
+                         s[3].TYPED_SLOT_##d = x3;) }
+#define TYPED_WRAPPER5(r, a, b, c, d, e) \
+    static TYPED_C_##r typed_##r##_##a##b##c##d##e(hlffi_callback_entry* entry, TYPED_C_##a x0, TYPED_C_##b x1, \
+                                                   TYPED_C_##c x2, TYPED_C_##d x3, TYPED_C_##e x4) { \
+        TYPED_BODY(r, 5, s[0].TYPED_SLOT_##a = x0; s[1].TYPED_SLOT_##b = x1; s[2].TYPED_SLOT_##c = x2; \
+                         s[3].TYPED_SLOT_##d = x3; s[4].TYPED_SLOT_##e = x4;) }
+#define TYPED_WRAPPER6(r, a, b, c, d, e, f) \
+    static TYPED_C_##r typed_##r##_##a##b##c##d##e##f(hlffi_callback_entry* entry, TYPED_C_##a x0, TYPED_C_##b x1, \
+                                                      TYPED_C_##c x2, TYPED_C_##d x3, TYPED_C_##e x4, \
+                                                      TYPED_C_##f x5) { \
+        TYPED_BODY(r, 6, s[0].TYPED_SLOT_##a = x0; s[1].TYPED_SLOT_##b = x1; s[2].TYPED_SLOT_##c = x2; \
+                         s[3].TYPED_SLOT_##d = x3; s[4].TYPED_SLOT_##e = x4; s[5].TYPED_SLOT_##f = x5;) }
+
+/* Table entries, in the same order the wrappers are generated */
+#define TYPED_ENTRY0(r)                   (void*)typed_##r##_,
+#define TYPED_ENTRY1(r, a)                (void*)typed_##r##_##a,
+#define TYPED_ENTRY2(r, a, b)             (void*)typed_##r##_##a##b,
+#define TYPED_ENTRY3(r, a, b, c)          (void*)typed_##r##_##a##b##c,
+#define TYPED_ENTRY4(r, a, b, c, d)       (void*)typed_##r##_##a##b##c##d,
+#define TYPED_ENTRY5(r, a, b, c, d, e)    (void*)typed_##r##_##a##b##c##d##e,
+#define TYPED_ENTRY6(r, a, b, c, d, e, f) (void*)typed_##r##_##a##b##c##d##e##f,
+
+/* Expand M for every W/F shape of n arguments; argument 0 is the most
+ * significant bit of the shape index (W = 0, F = 1). */
+#define TYPED_SHAPES1(M, ...) M(__VA_ARGS__, W) M(__VA_ARGS__, F)
+#define TYPED_SHAPES2(M, ...) TYPED_SHAPES1(M, __VA_ARGS__, W) TYPED_SHAPES1(M, __VA_ARGS__, F)
+#define TYPED_SHAPES3(M, ...) TYPED_SHAPES2(M, __VA_ARGS__, W) TYPED_SHAPES2(M, __VA_ARGS__, F)
+#define TYPED_SHAPES4(M, ...) TYPED_SHAPES3(M, __VA_ARGS__, W) TYPED_SHAPES3(M, __VA_ARGS__, F)
+#define TYPED_SHAPES5(M, ...) TYPED_SHAPES4(M, __VA_ARGS__, W) TYPED_SHAPES4(M, __VA_ARGS__, F)
+#define TYPED_SHAPES6(M, ...) TYPED_SHAPES5(M, __VA_ARGS__, W) TYPED_SHAPES5(M, __VA_ARGS__, F)
+
+#define TYPED_ALL(r, WRAP) \
+    WRAP##0(r) \
+    TYPED_SHAPES1(WRAP##1, r) TYPED_SHAPES2(WRAP##2, r) TYPED_SHAPES3(WRAP##3, r) \
+    TYPED_SHAPES4(WRAP##4, r) TYPED_SHAPES5(WRAP##5, r) TYPED_SHAPES6(WRAP##6, r)
+
+TYPED_ALL(W, TYPED_WRAPPER)
+TYPED_ALL(F, TYPED_WRAPPER)
+
+_Static_assert(HLFFI_MAX_TYPED_CALLBACK_ARGS == 6, "typed wrappers are generated up to 6 arguments");
+
+#define TYPED_SHAPE_COUNT ((2 << HLFFI_MAX_TYPED_CALLBACK_ARGS) - 1)
+
+/* [return class][(2^n - 1) + shape] */
+static void* const typed_wrappers[2][TYPED_SHAPE_COUNT] = {
+    { TYPED_ALL(W, TYPED_ENTRY) },
+    { TYPED_ALL(F, TYPED_ENTRY) }
+};
+
+/* Get the typed wrapper matching a signature, or NULL if unsupported */
+static void* get_typed_wrapper(int nargs, const hlffi_arg_type* arg_types, hlffi_arg_type return_type) {
+    if (nargs < 0 || nargs > HLFFI_MAX_TYPED_CALLBACK_ARGS) return NULL;
+
+    int shape = 0;
+    for (int i = 0; i < nargs; i++) {
+        if (arg_types[i] == HLFFI_ARG_VOID) return NULL;
+        shape = (shape << 1) | (arg_types[i] == HLFFI_ARG_FLOAT ? 1 : 0);
     }
+    return typed_wrappers[return_type == HLFFI_ARG_FLOAT ? 1 : 0][(1 << nargs) - 1 + shape];
 }
 
 /* ========== PUBLIC API ========== */
@@ -190,13 +330,13 @@ static hl_type* create_callback_function_type(int nargs) {
 }
 
 /* Helper: Map hlffi_arg_type to HashLink hl_type* */
-static hl_type* map_callback_type(hlffi_arg_type type) {
+static hl_type* map_callback_type(hlffi_vm* vm, hlffi_arg_type type) {
     switch (type) {
         case HLFFI_ARG_VOID:    return &hlt_void;
         case HLFFI_ARG_INT:     return &hlt_i32;
         case HLFFI_ARG_FLOAT:   return &hlt_f64;
         case HLFFI_ARG_BOOL:    return &hlt_bool;
-        case HLFFI_ARG_STRING:  return &hlt_bytes;
+        case HLFFI_ARG_STRING:  return vm->string_type ? vm->string_type : &hlt_bytes;
         case HLFFI_ARG_DYNAMIC: return &hlt_dyn;
         default:                 return &hlt_dyn;
     }
@@ -208,6 +348,7 @@ static hl_type* map_callback_type(hlffi_arg_type type) {
  * Unlike the dynamic version, this creates properly-typed closures that match
  * Haxe's static type system (e.g., String->Void, (Int,Int)->Int). */
 static hl_type* create_typed_callback_function_type(
+    hlffi_vm* vm,
     int nargs,
     const hlffi_arg_type* arg_types,
     hlffi_arg_type return_type
@@ -232,7 +373,7 @@ static hl_type* create_typed_callback_function_type(
      * Total args = 1 (closure) + nargs (actual args) */
     int total_args = 1 + nargs;
     tfun->nargs = total_args;
-    tfun->ret = map_callback_type(return_type);  /* Specific return type! */
+    tfun->ret = map_callback_type(vm, return_type);  /* Specific return type! */
     tfun->parent = type;
 
     /* Allocate args array */
@@ -246,7 +387,7 @@ static hl_type* create_typed_callback_function_type(
     /* First arg is closure value (always dynamic), rest are specific types */
     tfun->args[0] = &hlt_dyn;
     for (int i = 0; i < nargs; i++) {
-        tfun->args[i + 1] = map_callback_type(arg_types[i]);
+        tfun->args[i + 1] = map_callback_type(vm, arg_types[i]);
     }
 
     /* Link function descriptor to type */
@@ -267,55 +408,106 @@ static void free_function_type(hl_type* type) {
     free(type);
 }
 
-bool hlffi_register_callback(hlffi_vm* vm, const char* name, hlffi_native_func func, int nargs) {
-    if (!vm) return false;
-    if (!name || !func) {
-        set_error(vm, "Invalid callback name or function");
-        return false;
+/* ========== CALLBACK REGISTRY ========== */
+
+/* Registered callbacks live in a chained hash table of individually allocated
+ * entries. Entry addresses never change while registered (growing only relinks
+ * the nodes), which matters because every closure points at its entry. */
+
+#define CALLBACK_REGISTRY_INITIAL_CAPACITY 64
+
+static hlffi_callback_entry* callback_find(hlffi_vm* vm, const char* name, int hash) {
+    if (vm->callback_capacity == 0) return NULL;
+
+    hlffi_callback_entry* e = vm->callbacks[hash & (vm->callback_capacity - 1)];
+    for (; e; e = e->next) {
+        if (e->hash == hash && strcmp(e->name, name) == 0) return e;
     }
-    if (nargs < 0 || nargs > 4) {
-        set_error(vm, "Callback arity must be 0-4 arguments");
-        return false;
+    return NULL;
+}
+
+/* Rehash the existing entries into new_capacity buckets (entries do not move) */
+static bool callback_registry_grow(hlffi_vm* vm, int new_capacity) {
+    hlffi_callback_entry** buckets =
+        (hlffi_callback_entry**)calloc(new_capacity, sizeof(hlffi_callback_entry*));
+    if (!buckets) return false;
+
+    for (int i = 0; i < vm->callback_capacity; i++) {
+        hlffi_callback_entry* e = vm->callbacks[i];
+        while (e) {
+            hlffi_callback_entry* next = e->next;
+            int slot = e->hash & (new_capacity - 1);
+            e->next = buckets[slot];
+            buckets[slot] = e;
+            e = next;
+        }
     }
-    if (vm->callback_count >= HLFFI_MAX_CALLBACKS) {
-        set_error(vm, "Maximum number of callbacks reached");
-        return false;
+
+    free(vm->callbacks);
+    vm->callbacks = buckets;
+    vm->callback_capacity = new_capacity;
+    return true;
+}
+
+static void callback_entry_free(hlffi_callback_entry* entry) {
+    /* Remove GC root if it was rooted
+     * This makes the closure eligible for garbage collection.
+     * HashLink's GC will clean up the closure and its type automatically. */
+    if (entry->is_rooted) {
+        hl_remove_root(&entry->hl_closure);
     }
 
+    /* NOTE: Do NOT manually free the closure or its type!
+     * The closure is GC-managed. After removing the root, the GC will
+     * automatically clean it up during the next collection cycle. */
+    free(entry->name);
+    free(entry);
+}
+
+/* Allocate a closure for func_type/wrapper bound to a new entry and register it.
+ * Takes ownership of func_type on failure. The caller fills the typed fields. */
+static hlffi_callback_entry* callback_add(
+    hlffi_vm* vm,
+    const char* name,
+    hlffi_native_func func,
+    int nargs,
+    hl_type* func_type,
+    void* wrapper_func
+) {
+    int hash = hl_hash_utf8(name);
+
     /* Check for duplicate name */
-    for (int i = 0; i < vm->callback_count; i++) {
-        if (strcmp(vm->callbacks[i].name, name) == 0) {
-            set_error(vm, "Callback with this name already registered");
-            return false;
+    if (callback_find(vm, name, hash)) {
+        free_function_type(func_type);
+        set_error(vm, "Callback with this name already registered");
+        return NULL;
+    }
+
+    /* Keep the load factor <= 1 */
+    if (vm->callback_count >= vm->callback_capacity) {
+        int capacity = vm->callback_capacity > 0 ? vm->callback_capacity * 2
+                                                 : CALLBACK_REGISTRY_INITIAL_CAPACITY;
+        if (!callback_registry_grow(vm, capacity)) {
+            free_function_type(func_type);
+            set_error(vm, "Failed to grow callback registry");
+            return NULL;
         }
     }
 
-    /* Get the callback entry slot */
-    hlffi_callback_entry* entry = &vm->callbacks[vm->callback_count];
+    hlffi_callback_entry* entry = (hlffi_callback_entry*)calloc(1, sizeof(hlffi_callback_entry));
+    if (entry) entry->name = strdup(name);
+    if (!entry || !entry->name) {
+        free(entry);
+        free_function_type(func_type);
+        set_error(vm, "Failed to allocate callback entry");
+        return NULL;
+    }
 
     /* Store callback info */
-    strncpy(entry->name, name, sizeof(entry->name) - 1);
-    entry->name[sizeof(entry->name) - 1] = '\0';
+    entry->hash = hash;
     entry->c_func = func;
     entry->nargs = nargs;
     entry->vm = vm;
-    entry->is_rooted = false;
-    entry->hl_closure = NULL;
-
-    /* Create function type */
-    hl_type* func_type = create_callback_function_type(nargs);
-    if (!func_type) {
-        set_error(vm, "Failed to create callback function type");
-        return false;
-    }
-
-    /* Get wrapper function for this arity */
-    void* wrapper_func = get_wrapper_for_arity(nargs);
-    if (!wrapper_func) {
-        free_function_type(func_type);
-        set_error(vm, "Unsupported callback arity (max 4 args)");
-        return false;
-    }
 
     /* Update GC stack_top before allocation */
     HLFFI_UPDATE_STACK_TOP();
@@ -324,9 +516,11 @@ bool hlffi_register_callback(hlffi_vm* vm, const char* name, hlffi_native_func f
      * This creates a closure that wraps our C function */
     vclosure* closure = hl_alloc_closure_ptr(func_type, wrapper_func, entry);
     if (!closure) {
+        free(entry->name);
+        free(entry);
         free_function_type(func_type);
         set_error(vm, "Failed to allocate closure");
-        return false;
+        return NULL;
     }
 
     /* Add GC root to prevent collection */
@@ -334,29 +528,61 @@ bool hlffi_register_callback(hlffi_vm* vm, const char* name, hlffi_native_func f
     entry->hl_closure = closure;
     entry->is_rooted = true;
 
-    /* Increment callback count */
+    int slot = hash & (vm->callback_capacity - 1);
+    entry->next = vm->callbacks[slot];
+    vm->callbacks[slot] = entry;
     vm->callback_count++;
 
-    return true;
+    return entry;
+}
+
+void hlffi_callbacks_clear(hlffi_vm* vm) {
+    if (!vm || !vm->callbacks) return;
+
+    for (int i = 0; i < vm->callback_capacity; i++) {
+        hlffi_callback_entry* e = vm->callbacks[i];
+        while (e) {
+            hlffi_callback_entry* next = e->next;
+            callback_entry_free(e);
+            e = next;
+        }
+    }
+    free(vm->callbacks);
+
+    vm->callbacks = NULL;
+    vm->callback_capacity = 0;
+    vm->callback_count = 0;
+}
+
+bool hlffi_register_callback(hlffi_vm* vm, const char* name, hlffi_native_func func, int nargs) {
+    if (!vm) return false;
+    if (!name || !func) {
+        set_error(vm, "Invalid callback name or function");
+        return false;
+    }
+    if (nargs < 0 || nargs > HLFFI_MAX_CALLBACK_ARGS) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Callback arity must be 0-%d arguments", HLFFI_MAX_CALLBACK_ARGS);
+        return false;
+    }
+
+    /* Get wrapper function for this arity */
+    void* wrapper_func = get_wrapper_for_arity(nargs);
+    if (!wrapper_func) {
+        set_error(vm, "Unsupported callback arity");
+        return false;
+    }
+
+    /* Create function type */
+    hl_type* func_type = create_callback_function_type(nargs);
+    if (!func_type) {
+        set_error(vm, "Failed to create callback function type");
+        return false;
+    }
+
+    return callback_add(vm, name, func, nargs, func_type, wrapper_func) != NULL;
 }
 
-/* TODO: Fix typed callbacks to work with primitive types
- *
- * Current limitation: Wrapper functions expect vdynamic* for all arguments,
- * but typed closures pass primitives (Int/Float/Bool) as raw values.
- * This causes crashes when callbacks with primitive arguments are invoked.
- *
- * Required fix: Create typed wrapper functions for all type combinations:
- *   - wrapper_ii_i for (Int,Int)->Int
- *   - wrapper_fff_f for (Float,Float,Float)->Float
- *   - wrapper_sis_s for (String,Int,String)->String
- *   - etc.
- *
- * Alternatively: Generate wrappers dynamically based on type signature,
- * or use libffi/similar to handle arbitrary function signatures.
- *
- * Until fixed, use hlffi_register_callback() with Dynamic types in Haxe.
- */
 bool hlffi_register_callback_typed(
     hlffi_vm* vm,
     const char* name,
@@ -370,73 +596,39 @@ bool hlffi_register_callback_typed(
         set_error(vm, "Invalid callback name or function");
         return false;
     }
-    if (nargs < 0 || nargs > 4) {
-        set_error(vm, "Callback arity must be 0-4 arguments");
+    if (nargs < 0 || nargs > HLFFI_MAX_TYPED_CALLBACK_ARGS) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "Typed callback arity must be 0-%d arguments", HLFFI_MAX_TYPED_CALLBACK_ARGS);
         return false;
     }
     if (nargs > 0 && !arg_types) {
         set_error(vm, "Argument types required for callbacks with arguments");
         return false;
     }
-    if (vm->callback_count >= HLFFI_MAX_CALLBACKS) {
-        set_error(vm, "Maximum number of callbacks reached");
-        return false;
-    }
 
-    /* Check for duplicate name */
-    for (int i = 0; i < vm->callback_count; i++) {
-        if (strcmp(vm->callbacks[i].name, name) == 0) {
-            set_error(vm, "Callback with this name already registered");
-            return false;
-        }
+    /* Get the wrapper whose C signature matches the raw argument types */
+    void* wrapper_func = get_typed_wrapper(nargs, arg_types, return_type);
+    if (!wrapper_func) {
+        set_error(vm, "Unsupported typed callback signature (HLFFI_ARG_VOID argument)");
+        return false;
     }
 
-    /* Get the callback entry slot */
-    hlffi_callback_entry* entry = &vm->callbacks[vm->callback_count];
-
-    /* Store callback info */
-    strncpy(entry->name, name, sizeof(entry->name) - 1);
-    entry->name[sizeof(entry->name) - 1] = '\0';
-    entry->c_func = func;
-    entry->nargs = nargs;
-    entry->vm = vm;
-    entry->is_rooted = false;
-    entry->hl_closure = NULL;
-
     /* Create TYPED function type (maps to Haxe static types!) */
-    hl_type* func_type = create_typed_callback_function_type(nargs, arg_types, return_type);
+    hl_type* func_type = create_typed_callback_function_type(vm, nargs, arg_types, return_type);
     if (!func_type) {
         set_error(vm, "Failed to create callback function type");
         return false;
     }
 
-    /* Get wrapper function for this arity */
-    void* wrapper_func = get_wrapper_for_arity(nargs);
-    if (!wrapper_func) {
-        free_function_type(func_type);
-        set_error(vm, "Unsupported callback arity (max 4 args)");
-        return false;
-    }
-
-    /* Update GC stack_top before allocation */
-    HLFFI_UPDATE_STACK_TOP();
+    hlffi_callback_entry* entry = callback_add(vm, name, func, nargs, func_type, wrapper_func);
+    if (!entry) return false;
 
-    /* Create closure using hl_alloc_closure_ptr
-     * This creates a closure that wraps our C function */
-    vclosure* closure = hl_alloc_closure_ptr(func_type, wrapper_func, entry);
-    if (!closure) {
-        free_function_type(func_type);
-        set_error(vm, "Failed to allocate closure");
-        return false;
+    /* Read by the typed wrapper on each call (no call can happen before this returns) */
+    entry->typed = true;
+    for (int i = 0; i < nargs; i++) {
+        entry->arg_types[i] = arg_types[i];
     }
-
-    /* Add GC root to prevent collection */
-    hl_add_root(&entry->hl_closure);
-    entry->hl_closure = closure;
-    entry->is_rooted = true;
-
-    /* Increment callback count */
-    vm->callback_count++;
+    entry->return_type = return_type;
 
     return true;
 }
@@ -445,66 +637,85 @@ hlffi_value* hlffi_get_callback(hlffi_vm* vm, const char* name) {
     if (!vm || !name) return NULL;
 
     /* Find callback by name */
-    for (int i = 0; i < vm->callback_count; i++) {
-        if (strcmp(vm->callbacks[i].name, name) == 0) {
-            hlffi_callback_entry* entry = &vm->callbacks[i];
-
-            /* Wrap the closure in hlffi_value */
-            hlffi_value* value = (hlffi_value*)malloc(sizeof(hlffi_value));
-            if (!value) {
-                set_error(vm, "Failed to allocate value wrapper");
-                return NULL;
-            }
-
-            value->hl_value = (vdynamic*)entry->hl_closure;
-            value->is_rooted = true;  /* Already rooted in callback table */
+    hlffi_callback_entry* entry = callback_find(vm, name, hl_hash_utf8(name));
+    if (!entry) {
+        set_error(vm, "Callback not found");
+        return NULL;
+    }
 
-            return value;
-        }
+    /* Wrap the closure in hlffi_value */
+    hlffi_value* value = hlffi_value_alloc(vm);
+    if (!value) {
+        set_error(vm, "Failed to allocate value wrapper");
+        return NULL;
     }
 
-    set_error(vm, "Callback not found");
-    return NULL;
+    value->hl_value = (vdynamic*)entry->hl_closure;
+    value->is_rooted = true;  /* Already rooted in callback table */
+
+    return value;
 }
 
 bool hlffi_unregister_callback(hlffi_vm* vm, const char* name) {
     if (!vm || !name) return false;
 
-    /* Find callback entry */
-    for (int i = 0; i < vm->callback_count; i++) {
-        hlffi_callback_entry* entry = &vm->callbacks[i];
-        if (strcmp(entry->name, name) == 0) {
-            /* Remove GC root if it was rooted
-             * This makes the closure eligible for garbage collection.
-             * HashLink's GC will clean up the closure and its type automatically. */
-            if (entry->is_rooted && entry->hl_closure) {
-                hl_remove_root(&entry->hl_closure);
+    /* Find and unlink the callback entry */
+    if (vm->callback_capacity > 0) {
+        int hash = hl_hash_utf8(name);
+        hlffi_callback_entry** link = &vm->callbacks[hash & (vm->callback_capacity - 1)];
+        for (; *link; link = &(*link)->next) {
+            hlffi_callback_entry* entry = *link;
+            if (entry->hash == hash && strcmp(entry->name, name) == 0) {
+                *link = entry->next;
+                vm->callback_count--;
+                callback_entry_free(entry);
+                return true;
             }
+        }
+    }
 
-            /* NOTE: Do NOT manually free the closure or its type!
-             * The closure is GC-managed. After removing the root, the GC will
-             * automatically clean it up during the next collection cycle. */
+    set_error(vm, "Callback not found");
+    return false;
+}
 
-            /* Clear the entry by shifting remaining callbacks down */
-            for (int j = i; j < vm->callback_count - 1; j++) {
-                vm->callbacks[j] = vm->callbacks[j + 1];
-            }
+/* ========== EXCEPTION HANDLING (IMPLEMENTED) ========== */
 
-            /* Clear the last entry */
-            memset(&vm->callbacks[vm->callback_count - 1], 0, sizeof(hlffi_callback_entry));
+/* Capture is cheap (a pointer store plus a copy of the stack addresses the
+ * runtime already recorded) so exception-heavy control flow pays nothing for
+ * text it never reads. hl_to_string and symbol resolution run at most once per
+ * exception, on the first hlffi_get_exception_message/_stack call. */
 
-            /* Decrement count */
-            vm->callback_count--;
+void hlffi_exception_capture(hlffi_vm* vm, vdynamic* exception) {
+    if (!vm) return;
 
-            return true;
-        }
+    /* The root is the slot address, registered once and reused */
+    if (!vm->exception_rooted) {
+        hl_add_root(&vm->exception);
+        vm->exception_rooted = true;
     }
+    vm->exception = exception;
+    vm->exception_pending = true;
+    vm->exception_msg_ready = false;
+    vm->exception_stack_ready = false;
 
-    set_error(vm, "Callback not found");
-    return false;
+    /* exc_stack_trace is overwritten by the next throw: keep our own copy */
+    hl_thread_info* t = hl_get_thread();
+    int count = t ? t->exc_stack_count : 0;
+    if (count > HLFFI_EXCEPTION_MAX_FRAMES) count = HLFFI_EXCEPTION_MAX_FRAMES;
+    if (count > 0) {
+        memcpy(vm->exception_trace, t->exc_stack_trace, count * sizeof(void*));
+    }
+    vm->exception_trace_count = count;
 }
 
-/* ========== EXCEPTION HANDLING (IMPLEMENTED) ========== */
+void hlffi_exception_release(hlffi_vm* vm) {
+    if (!vm) return;
+    hlffi_clear_exception(vm);
+    if (vm->exception_rooted) {
+        hl_remove_root(&vm->exception);
+        vm->exception_rooted = false;
+    }
+}
 
 hlffi_call_result hlffi_try_call_static(
     hlffi_vm* vm,
@@ -522,31 +733,19 @@ hlffi_call_result hlffi_try_call_static(
     }
 
     /* Clear previous exception state */
-    vm->exception_msg[0] = '\0';
-    vm->exception_stack[0] = '\0';
+    hlffi_clear_exception(vm);
 
     /* Call the normal hlffi_call_static */
-    /* The function already uses hl_dyn_call_safe internally */
+    /* The function already uses hl_dyn_call_safe internally and captures the exception */
     hlffi_value* result = hlffi_call_static(vm, class_name, method_name, argc, argv);
 
     /* Check if an exception occurred by looking at the error code */
     if (!result && vm->last_error == HLFFI_ERROR_EXCEPTION_THROWN) {
-        /* Exception was thrown */
-        /* Note: The actual exception object was returned by hl_dyn_call_safe,
-         * but hlffi_call_static currently doesn't store it.
-         * For now, we return the error message from the VM.
-         */
         if (out_result) *out_result = NULL;
         if (out_error) {
-            /* Store exception message */
-            const char* err_msg = hlffi_get_error(vm);
-            if (err_msg && err_msg[0]) {
-                strncpy(vm->exception_msg, err_msg, sizeof(vm->exception_msg) - 1);
-                vm->exception_msg[sizeof(vm->exception_msg) - 1] = '\0';
-                *out_error = vm->exception_msg;
-            } else {
-                *out_error = "Exception thrown (no message)";
-            }
+            /* Only format the message when the caller asks for it */
+            const char* msg = hlffi_get_exception_message(vm);
+            *out_error = msg ? msg : "Exception thrown (no message)";
         }
         return HLFFI_CALL_EXCEPTION;
     } else if (!result) {
@@ -600,69 +799,78 @@ hlffi_call_result hlffi_try_call_method(
 }
 
 const char* hlffi_get_exception_message(hlffi_vm* vm) {
-    if (!vm) return NULL;
+    if (!vm || !vm->exception_pending) return NULL;
+
+    if (!vm->exception_msg_ready) {
+        vm->exception_msg[0] = '\0';
+        if (vm->exception) {
+            HLFFI_UPDATE_STACK_TOP();  /* hl_to_string may allocate */
+            uchar* exc_str = hl_to_string(vm->exception);
+            char* utf8_msg = exc_str ? hl_to_utf8(exc_str) : NULL;
+            if (utf8_msg) {
+                strncpy(vm->exception_msg, utf8_msg, sizeof(vm->exception_msg) - 1);
+                vm->exception_msg[sizeof(vm->exception_msg) - 1] = '\0';
+            }
+        }
+        vm->exception_msg_ready = true;
+    }
+
     return vm->exception_msg[0] ? vm->exception_msg : NULL;
 }
 
 const char* hlffi_get_exception_stack(hlffi_vm* vm) {
-    if (!vm) return NULL;
-
-    /* If exception was explicitly cleared (no message), return NULL
-     * This is the key: exception_msg acts as the "exception active" flag */
-    if (!vm->exception_msg[0]) {
-        return NULL;
-    }
+    if (!vm || !vm->exception_pending) return NULL;
+    if (vm->exception_stack_ready) return vm->exception_stack;
 
-    /* Get thread info for stack trace */
-    hl_thread_info* t = hl_get_thread();
-    if (!t || t->exc_stack_count == 0) {
-        /* No stack trace available, but exception message exists
-         * Return a minimal message */
-        if (!vm->exception_stack[0]) {
-            snprintf(vm->exception_stack, sizeof(vm->exception_stack),
-                     "Stack trace not available\n");
-        }
-        return vm->exception_stack;
-    }
-
-    /* Build/rebuild stack trace string from captured addresses
-     * We regenerate each time to ensure it's fresh */
     char* buffer = vm->exception_stack;
     int buffer_size = sizeof(vm->exception_stack);
     int pos = 0;
 
+    if (vm->exception_trace_count == 0) {
+        snprintf(buffer, buffer_size, "Stack trace not available\n");
+        vm->exception_stack_ready = true;
+        return buffer;
+    }
+
+    /* Symbolicate the addresses captured at throw time */
     pos += snprintf(buffer + pos, buffer_size - pos, "Stack trace:\n");
 
-    for (int i = 0; i < t->exc_stack_count && pos < buffer_size - 1; i++) {
-        void* addr = t->exc_stack_trace[i];
+    for (int i = 0; i < vm->exception_trace_count && pos < buffer_size - 1; i++) {
+        void* addr = vm->exception_trace[i];
         uchar sym[256];
         int size = 256;
 
         /* Resolve symbol using HashLink's resolver */
-        uchar* str = hl_setup.resolve_symbol(addr, sym, &size);
-        if (str && pos < buffer_size - 1) {
+        uchar* str = hl_setup.resolve_symbol ? hl_setup.resolve_symbol(addr, sym, &size) : NULL;
+        if (str) {
             /* Convert from UTF-16 to UTF-8 */
             char* utf8 = hl_to_utf8(str);
             if (utf8) {
                 pos += snprintf(buffer + pos, buffer_size - pos, "  %s\n", utf8);
+                continue;
             }
-        } else {
-            /* Fallback: show address */
-            pos += snprintf(buffer + pos, buffer_size - pos, "  [0x%p]\n", addr);
         }
+        /* Fallback: show address */
+        pos += snprintf(buffer + pos, buffer_size - pos, "  [0x%p]\n", addr);
     }
 
     buffer[buffer_size - 1] = '\0';  /* Ensure null termination */
+    vm->exception_stack_ready = true;
     return buffer;
 }
 
 bool hlffi_has_exception(hlffi_vm* vm) {
     if (!vm) return false;
-    return vm->exception_msg[0] != '\0';
+    return vm->exception_pending;
 }
 
 void hlffi_clear_exception(hlffi_vm* vm) {
     if (!vm) return;
+    vm->exception = NULL;
+    vm->exception_pending = false;
+    vm->exception_msg_ready = false;
+    vm->exception_stack_ready = false;
+    vm->exception_trace_count = 0;
     vm->exception_msg[0] = '\0';
     vm->exception_stack[0] = '\0';
 }
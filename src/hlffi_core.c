@@ -104,6 +104,8 @@ const char* hlffi_get_error_string(hlffi_error_code code) {
             return "Thread stop failed";
         case HLFFI_ERROR_WRONG_THREAD:
             return "Wrong thread";
+        case HLFFI_ERROR_QUEUE_FULL:
+            return "Message queue full";
 
         /* Hot reload errors */
         case HLFFI_ERROR_RELOAD_NOT_SUPPORTED:
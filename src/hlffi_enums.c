@@ -134,7 +134,7 @@ hlffi_value* hlffi_enum_get_param(hlffi_value* value, int param_index) {
     if (!param_dyn) return NULL;
 
     /* Wrap in hlffi_value */
-    hlffi_value* result = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* result = hlffi_value_alloc(NULL);  /* Active scope, if any */
     if (!result) return NULL;
 
     result->hl_value = param_dyn;
@@ -165,7 +165,7 @@ hlffi_value* hlffi_enum_alloc_simple(hlffi_vm* vm, const char* type_name, int in
     if (!e) return NULL;
 
     /* Wrap in hlffi_value */
-    hlffi_value* result = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* result = hlffi_value_alloc(vm);
     if (!result) return NULL;
 
     result->hl_value = (vdynamic*)e;
@@ -218,7 +218,7 @@ hlffi_value* hlffi_enum_alloc(hlffi_vm* vm, const char* type_name, int index,
     }
 
     /* Wrap in hlffi_value */
-    hlffi_value* result = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* result = hlffi_value_alloc(vm);
     if (!result) return NULL;
 
     result->hl_value = (vdynamic*)e;
@@ -265,7 +265,7 @@ hlffi_value* hlffi_hlc_new(hlffi_vm* vm, const char* class_name, int argc, hlffi
     }
 
     /* Wrap result in hlffi_value */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) {
         hlffi_set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY,
             "Failed to allocate hlffi_value");
@@ -273,8 +273,7 @@ hlffi_value* hlffi_hlc_new(hlffi_vm* vm, const char* class_name, int argc, hlffi
     }
 
     wrapped->hl_value = instance;
-    wrapped->is_rooted = true;
-    hl_add_root(&wrapped->hl_value);
+    hlffi_value_add_root(wrapped);
 
     return wrapped;
 }
@@ -379,7 +378,7 @@ hlffi_value* hlffi_hlc_call_static(hlffi_vm* vm, const char* class_name,
     }
 
     /* Wrap result */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) {
         hlffi_set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY,
             "Failed to allocate hlffi_value");
@@ -438,7 +437,7 @@ hlffi_value* hlffi_hlc_get_static_field(hlffi_vm* vm, const char* class_name, co
     if (isExc) return NULL;
 
     /* Wrap result */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
 
     wrapped->hl_value = value;
@@ -33,6 +33,13 @@ hlffi_integration_mode hlffi_get_integration_mode(hlffi_vm* vm) {
 hlffi_error_code hlffi_update(hlffi_vm* vm, float delta_time) {
     if (!vm) return HLFFI_ERROR_NULL_VM;
 
+    /* Safe point: apply a hot reload parsed in the background
+     * (a running VM thread applies it from its own message loop) */
+    if (hlffi_reload_pending(vm) &&
+        !(vm->integration_mode == HLFFI_MODE_THREADED && vm->thread_running)) {
+        hlffi_reload_apply_pending(vm);
+    }
+
     /* Process both UV and Haxe event loops
      * This processes:
      * - UV async I/O, network, file system (libuv)
@@ -13,19 +13,41 @@
 #include <hlmodule.h>
 #include <string.h>
 
-/* Maximum number of registered callbacks */
-#define HLFFI_MAX_CALLBACKS 64
-
-/* Callback entry storage */
-typedef struct {
-    char name[64];
+/* Stack frames kept per captured exception */
+#define HLFFI_EXCEPTION_MAX_FRAMES 64
+
+/* Callback registry entry (hlffi_callbacks.c): individually allocated so its
+ * address, which the HashLink closure holds, stays stable while registered */
+typedef struct hlffi_callback_entry {
+    struct hlffi_callback_entry* next;  /* Bucket chain */
+    int hash;                           /* hl_hash_utf8() of name */
+    char* name;                         /* Owned, malloc'd */
     hlffi_native_func c_func;
     int nargs;
+    bool typed;                                               /* Registered via hlffi_register_callback_typed */
+    hlffi_arg_type arg_types[HLFFI_MAX_TYPED_CALLBACK_ARGS];   /* Typed callbacks: raw argument kinds */
+    hlffi_arg_type return_type;                               /* Typed callbacks: raw return kind */
     vclosure* hl_closure;
     bool is_rooted;
     struct hlffi_vm* vm;  /* VM pointer for wrapper access */
 } hlffi_callback_entry;
 
+/* Type name index entry (open-addressing slot, name == NULL means empty) */
+typedef struct {
+    int hash;           /* hl_hash_utf8() of name */
+    char* name;         /* UTF-8 type name (owned, malloc'd) */
+    hl_type* type;
+} hlffi_type_index_entry;
+
+/* Native map layout remembered per map class (hlffi_maps.c) */
+#define HLFFI_MAP_TYPE_SLOTS 4
+
+typedef struct {
+    hl_type* type;          /* Map class seen by the map API */
+    int kind;               /* Native hashtable kind, 0 = not a native map */
+    int h_offset;           /* Byte offset of the hashtable field 'h' */
+} hlffi_map_type_entry;
+
 /**
  * Internal VM structure.
  *
@@ -55,18 +77,71 @@ struct hlffi_vm {
     bool module_loaded;
     bool entry_called;
 
+    /* Type name index (HOBJ/HENUM/HABSTRACT), built at load / after reload */
+    hlffi_type_index_entry* type_index;
+    int type_index_capacity;    /* Power of two, 0 if not built */
+    int type_index_count;
+    hl_type* string_type;       /* "String" class from the index, NULL if absent */
+
+    /* Interned strings (hlffi_string_intern), chained hash table of stable nodes */
+    struct hlffi_string_intern_entry** string_intern;
+    int string_intern_capacity; /* Power of two, 0 if empty */
+    int string_intern_count;
+
+    /* Value scopes (hlffi_scope_begin/end): chain of slot blocks behind one
+     * root, reused across scopes */
+    struct hlffi_scope_block* scope_blocks;    /* First block, rooted once allocated */
+    struct hlffi_scope_block* scope_current;   /* Block being filled */
+    int scope_depth;
+    const void* scope_owner;                   /* Thread tag of the opening thread, NULL if none */
+
+    /* Handle table (hlffi_handle_*): objects in one rooted array, generations
+     * and free list in C memory */
+    vdynamic** handle_objects;      /* GC raw memory, rooted once allocated */
+    struct hlffi_handle_slot* handle_slots;
+    int handle_capacity;
+    int handle_count;               /* Live handles */
+    int handle_free;                /* Free list head, -1 if empty */
+
+    /* Map class layouts, reset with the type index */
+    hlffi_map_type_entry map_types[HLFFI_MAP_TYPE_SLOTS];
+    int map_type_count;
+    int map_type_next;          /* Round-robin replacement slot */
+
     /* Hot reload support */
     bool hot_reload_enabled;
     const char* loaded_file;
-    int file_time;  /* Last modification time for auto-reload check */
+    /* File watch for hlffi_check_reload (hlffi_reload.c) */
+    int watch_fd;               /* inotify fd (Linux), -1 when polling with stat() */
+    int64_t file_mtime;         /* Last observed modification time (ns) and size */
+    int64_t file_size;
+    bool change_pending;        /* Change seen, waiting for writes to settle */
+    double change_time_ms;      /* Last sign of writing */
+    double next_poll_ms;        /* Earliest time of the next watch check */
+    int reload_poll_ms;         /* Min interval between checks, 0 = every call */
+    int reload_debounce_ms;     /* Quiet time required before reloading */
+    void* reload_job;           /* In-flight hlffi_reload_module_async (hlffi_reload.c) */
+    hlffi_reload_stats reload_stats;  /* Phase timings of the last reload */
+    bool reload_stats_valid;
     hlffi_reload_callback reload_callback;
     void* reload_userdata;
+    unsigned module_generation; /* Bumped by each module patch; caches stamped
+                                 * with an older value re-resolve on next use */
 
-    /* Phase 6: Callback storage */
-    hlffi_callback_entry callbacks[HLFFI_MAX_CALLBACKS];
+    /* Phase 6: Callback registry, chained hash table of stable entries */
+    hlffi_callback_entry** callbacks;
+    int callback_capacity;      /* Power of two, 0 if empty */
     int callback_count;
 
-    /* Phase 6: Exception storage */
+    /* Phase 6: Exception storage. The raw exception and its stack addresses
+     * are captured on throw; message/stack text is formatted on first request */
+    vdynamic* exception;        /* Last exception object (root added on first capture) */
+    bool exception_rooted;
+    bool exception_pending;
+    bool exception_msg_ready;   /* exception_msg is formatted from exception */
+    bool exception_stack_ready; /* exception_stack is formatted from exception_trace */
+    int exception_trace_count;
+    void* exception_trace[HLFFI_EXCEPTION_MAX_FRAMES];
     char exception_msg[512];
     char exception_stack[2048];
 
@@ -74,10 +149,10 @@ struct hlffi_vm {
     void* thread_handle;        /* pthread_t* */
     void* thread_mutex;         /* pthread_mutex_t* */
     void* thread_cond_var;      /* pthread_cond_t* */
-    void* thread_response_cond; /* pthread_cond_t* for sync responses */
     void* message_queue;        /* hlffi_thread_message_queue* */
     bool thread_running;
     bool thread_should_stop;
+    int thread_queue_limit;     /* Max pending messages, 0 = unbounded */
 };
 
 /**
@@ -88,8 +163,45 @@ struct hlffi_vm {
 struct hlffi_value {
     vdynamic* hl_value;
     bool is_rooted;  /* Track if we added a GC root */
+    bool in_scope;   /* Slot of a value scope block: released by hlffi_scope_end, never free()d */
 };
 
+/* Value scope block (hlffi_values.c). GC-allocated raw memory, so the GC scans
+ * the slots conservatively: rooting the first block keeps the whole chain and
+ * every value handed out from it alive. */
+#define HLFFI_SCOPE_BLOCK_VALUES 256
+
+typedef struct hlffi_scope_block {
+    struct hlffi_scope_block* next;
+    int used;                                            /* Slots handed out */
+    struct hlffi_value values[HLFFI_SCOPE_BLOCK_VALUES];
+} hlffi_scope_block;
+
+/* Handle table slot (hlffi_values.c). A handle packs the slot index (low
+ * HLFFI_HANDLE_INDEX_BITS) with the slot's generation, bumped on release so
+ * stale handles stop matching. Generation 0 is never used: handle 0 is null. */
+#define HLFFI_HANDLE_INDEX_BITS 20
+#define HLFFI_HANDLE_MAX_SLOTS (1 << HLFFI_HANDLE_INDEX_BITS)
+#define HLFFI_HANDLE_GENERATION_MASK ((1u << (32 - HLFFI_HANDLE_INDEX_BITS)) - 1)
+typedef struct hlffi_handle_slot {
+    uint32_t generation;
+    bool live;
+    int next_free;      /* Free list link, -1 at the end */
+} hlffi_handle_slot;
+
+/* hlffi_value_storage (public) must be able to hold a struct hlffi_value */
+_Static_assert(sizeof(struct hlffi_value) <= sizeof(hlffi_value_storage),
+               "hlffi_value_storage too small for struct hlffi_value");
+
+/* Interned string: chained bucket node. Nodes never move, so the embedded
+ * value can be handed out and its hl_value slot used as the GC root. */
+typedef struct hlffi_string_intern_entry {
+    struct hlffi_string_intern_entry* next;
+    int hash;               /* hl_hash_utf8() of key */
+    char* key;              /* UTF-8 source string (owned, malloc'd) */
+    struct hlffi_value value;
+} hlffi_string_intern_entry;
+
 /* ========== INTERNAL GC STACK FIX ========== */
 
 /**
@@ -144,6 +256,144 @@ static inline void hlffi_set_error(hlffi_vm* vm, hlffi_error_code code, const ch
     }
 }
 
+/* ========== TYPE NAME INDEX (hlffi_types.c) ========== */
+
+/**
+ * Build (or rebuild) the name -> hl_type* index from vm->module->code.
+ * Called from hlffi_load_file/hlffi_load_memory and after hot reload.
+ * No-op in HLC mode (there is no code->types table).
+ */
+void hlffi_type_index_build(hlffi_vm* vm);
+
+/**
+ * Release the type name index.
+ */
+void hlffi_type_index_free(hlffi_vm* vm);
+
+/**
+ * Look up a type by its fully qualified name (e.g. "haxe.ds.StringMap").
+ * Returns NULL if not found or if the index has not been built.
+ * Does not set an error message.
+ */
+hl_type* hlffi_type_index_lookup(hlffi_vm* vm, const char* name);
+
+/**
+ * Same as hlffi_type_index_lookup() but only returns HOBJ (class) types.
+ */
+static inline hl_type* hlffi_type_index_lookup_class(hlffi_vm* vm, const char* name) {
+    hl_type* t = hlffi_type_index_lookup(vm, name);
+    return (t && t->kind == HOBJ && t->obj) ? t : NULL;
+}
+
+/* ========== CALLBACK REGISTRY (hlffi_callbacks.c) ========== */
+
+/**
+ * Unregister every callback, releasing closure roots and entries.
+ * Called from hlffi_destroy().
+ */
+void hlffi_callbacks_clear(hlffi_vm* vm);
+
+/* ========== EXCEPTIONS (hlffi_callbacks.c) ========== */
+
+/**
+ * Record an exception thrown by a Haxe call: keeps the exception object
+ * (rooted) and copies the thread's captured stack addresses. Does no string
+ * conversion; hlffi_get_exception_message/_stack format on demand.
+ */
+void hlffi_exception_capture(hlffi_vm* vm, vdynamic* exception);
+
+/**
+ * Drop the pending exception and its GC root. Called from hlffi_destroy().
+ */
+void hlffi_exception_release(hlffi_vm* vm);
+
+/* ========== VALUE WRAPPERS (hlffi_values.c) ========== */
+
+/**
+ * Allocate a null, unrooted value wrapper. Inside a value scope the wrapper is
+ * a scope slot (kept alive by the scope, released by hlffi_scope_end);
+ * otherwise it is malloc'd and owned by the caller (hlffi_value_free).
+ * vm may be NULL for APIs that take no VM: the thread's active scope is used.
+ */
+hlffi_value* hlffi_value_alloc(hlffi_vm* vm);
+
+/**
+ * Same as hlffi_value_alloc() holding v.
+ */
+static inline hlffi_value* hlffi_value_wrap(hlffi_vm* vm, vdynamic* v) {
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
+    if (wrapped) wrapped->hl_value = v;
+    return wrapped;
+}
+
+/**
+ * Keep the object held by a freshly allocated wrapper alive: adds a GC root
+ * to malloc'd wrappers, scope slots are already reachable through the scope.
+ */
+static inline void hlffi_value_add_root(hlffi_value* wrapped) {
+    if (!wrapped->in_scope && !wrapped->is_rooted) {
+        hl_add_root(&wrapped->hl_value);
+        wrapped->is_rooted = true;
+    }
+}
+
+/* Hot reload watch defaults (hlffi_set_reload_timing) */
+#define HLFFI_RELOAD_DEFAULT_POLL_MS 250
+#define HLFFI_RELOAD_DEFAULT_DEBOUNCE_MS 100
+
+/* VM thread wait slice while an async reload is parsing (THREADED mode) */
+#define HLFFI_RELOAD_APPLY_POLL_MS 5
+
+/**
+ * Start watching vm->loaded_file for hlffi_check_reload(): records the
+ * current modification time/size and opens the inotify watch where
+ * available. Called by hlffi_load_file() when hot reload is enabled.
+ */
+void hlffi_reload_watch_start(hlffi_vm* vm);
+
+/**
+ * Close the file watch. Called from hlffi_destroy().
+ */
+void hlffi_reload_watch_stop(hlffi_vm* vm);
+
+/**
+ * Apply a parsed async reload if one is ready (VM thread safe point).
+ * Called from hlffi_update() and, in THREADED mode, from the VM thread's
+ * message loop. The worker never calls into the VM.
+ */
+void hlffi_reload_apply_pending(hlffi_vm* vm);
+
+/**
+ * Wake the VM thread if it is idle (THREADED mode, no-op otherwise).
+ * Called after publishing an async reload so the thread starts polling it.
+ */
+void hlffi_thread_wake(hlffi_vm* vm);
+
+/**
+ * Wait for an in-flight async reload and discard it. Called from hlffi_destroy().
+ */
+void hlffi_reload_async_cancel(hlffi_vm* vm);
+
+/**
+ * Release the scope blocks' root. Called from hlffi_destroy().
+ */
+void hlffi_scope_release(hlffi_vm* vm);
+
+/**
+ * Release every handle and the table's root. Called from hlffi_destroy().
+ */
+void hlffi_handles_clear(hlffi_vm* vm);
+
+/* ========== ARRAY ACCESS (hlffi_values.c) ========== */
+
+/**
+ * Resolve the element storage of an array of objects: a NativeArray of
+ * pointers (HARRAY) or a Haxe Array<T> backed by hl.types.ArrayObj.
+ * Sets *out_data to the first element and *out_count to the logical length.
+ * Returns false for any other value. Does not set an error message.
+ */
+bool hlffi_array_object_elements(vdynamic* arr, vdynamic*** out_data, int* out_count);
+
 /* HashLink internal function for field lookup.
  *
  * This function is normally static in vendor/hashlink/src/std/obj.c, but can be
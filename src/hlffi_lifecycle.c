@@ -84,6 +84,10 @@ hlffi_vm* hlffi_create(void) {
     vm->entry_called = false;
     vm->hot_reload_enabled = false;
     vm->loaded_file = NULL;
+    vm->handle_free = -1;
+    vm->watch_fd = -1;
+    vm->reload_poll_ms = HLFFI_RELOAD_DEFAULT_POLL_MS;
+    vm->reload_debounce_ms = HLFFI_RELOAD_DEFAULT_DEBOUNCE_MS;
     vm->error_msg[0] = '\0';
 
     return vm;
@@ -223,6 +227,14 @@ hlffi_error_code hlffi_load_file(hlffi_vm* vm, const char* path) {
     vm->module_loaded = true;
     vm->loaded_file = path;
 
+    /* Index type names once so by-name lookups don't scan code->types */
+    hlffi_type_index_build(vm);
+
+    /* Baseline for hlffi_check_reload (file watch) */
+    if (vm->hot_reload_enabled) {
+        hlffi_reload_watch_start(vm);
+    }
+
     set_error(vm, HLFFI_OK, NULL);
     return HLFFI_OK;
 
@@ -293,6 +305,9 @@ hlffi_error_code hlffi_load_memory(hlffi_vm* vm, const void* data, size_t size)
 
     vm->module_loaded = true;
 
+    /* Index type names once so by-name lookups don't scan code->types */
+    hlffi_type_index_build(vm);
+
     set_error(vm, HLFFI_OK, NULL);
     return HLFFI_OK;
 
@@ -324,11 +339,12 @@ hlffi_error_code hlffi_call_entry(hlffi_vm* vm) {
     cl.fun = hl_entry_point;
 
     /* Call entry point with exception handling */
-    (void)hl_dyn_call_safe(&cl, NULL, 0, &isExc);
+    vdynamic* ret = hl_dyn_call_safe(&cl, NULL, 0, &isExc);
 
     if (isExc) {
         /* In HLC mode, we skip hl_print_uncaught_exception to avoid DLL dependency
          * The caller can handle the error appropriately */
+        hlffi_exception_capture(vm, ret);
         set_error(vm, HLFFI_ERROR_EXCEPTION_THROWN, "Exception in entry point");
         return HLFFI_ERROR_EXCEPTION_THROWN;
     }
@@ -355,6 +371,7 @@ hlffi_error_code hlffi_call_entry(hlffi_vm* vm) {
     vdynamic* ret = hl_dyn_call_safe(&cl, NULL, 0, &isExc);
 
     if (isExc) {
+        hlffi_exception_capture(vm, ret);
         /* Exception occurred */
         set_error(vm, HLFFI_ERROR_EXCEPTION_THROWN, "Exception in entry point");
         /* Print exception info to stderr */
@@ -373,6 +390,15 @@ hlffi_error_code hlffi_call_entry(hlffi_vm* vm) {
 void hlffi_destroy(hlffi_vm* vm) {
     if (!vm) return;
 
+    hlffi_callbacks_clear(vm);
+    hlffi_exception_release(vm);
+    hlffi_scope_release(vm);
+    hlffi_handles_clear(vm);
+    hlffi_reload_watch_stop(vm);
+    hlffi_reload_async_cancel(vm);
+    hlffi_string_intern_clear(vm);
+    hlffi_type_index_free(vm);
+
 #ifndef HLFFI_HLC_MODE
     /* JIT Mode: Free module and code */
 
@@ -1,26 +1,387 @@
 /**
  * Map Support for HLFFI
  *
- * Practical approach: Work with Map objects from Haxe via method calls
- * Maps are created in Haxe, manipulated in C, passed back to Haxe
+ * haxe.ds.IntMap, haxe.ds.StringMap and haxe.ds.ObjectMap (what Map<K,V>
+ * compiles to on HashLink) wrap a native hashtable in their field 'h'.
+ * Those maps are accessed through HashLink's hashtable primitives directly:
+ * no method lookup, no argument array, no boxing of keys.
+ *
+ * Any other map class (e.g. haxe.ds.EnumValueMap) falls back to
+ * reflective method calls.
  */
 
 #include "hlffi_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-/* Map operations via instance method calls */
+/* Use hlffi_set_error from internal header, create local alias */
+#define set_error hlffi_set_error
+
+/* ========== NATIVE HASHTABLES ========== */
+
+/* HashLink std hashtables (std/maps.c). Exported by libhl but not declared
+ * in hl.h; the map handles are opaque here. */
+typedef struct hlffi_hl_int_map hlffi_hl_int_map;
+typedef struct hlffi_hl_bytes_map hlffi_hl_bytes_map;
+typedef struct hlffi_hl_obj_map hlffi_hl_obj_map;
+
+HL_API hlffi_hl_int_map* hl_hialloc(void);
+HL_API void hl_hiset(hlffi_hl_int_map* m, int key, vdynamic* value);
+HL_API bool hl_hiexists(hlffi_hl_int_map* m, int key);
+HL_API vdynamic* hl_higet(hlffi_hl_int_map* m, int key);
+HL_API bool hl_hiremove(hlffi_hl_int_map* m, int key);
+HL_API varray* hl_hikeys(hlffi_hl_int_map* m);
+HL_API varray* hl_hivalues(hlffi_hl_int_map* m);
+HL_API void hl_hiclear(hlffi_hl_int_map* m);
+HL_API int hl_hisize(hlffi_hl_int_map* m);
+
+HL_API hlffi_hl_bytes_map* hl_hballoc(void);
+HL_API void hl_hbset(hlffi_hl_bytes_map* m, vbyte* key, vdynamic* value);
+HL_API bool hl_hbexists(hlffi_hl_bytes_map* m, vbyte* key);
+HL_API vdynamic* hl_hbget(hlffi_hl_bytes_map* m, vbyte* key);
+HL_API bool hl_hbremove(hlffi_hl_bytes_map* m, vbyte* key);
+HL_API varray* hl_hbkeys(hlffi_hl_bytes_map* m);
+HL_API varray* hl_hbvalues(hlffi_hl_bytes_map* m);
+HL_API void hl_hbclear(hlffi_hl_bytes_map* m);
+HL_API int hl_hbsize(hlffi_hl_bytes_map* m);
+
+HL_API hlffi_hl_obj_map* hl_hoalloc(void);
+HL_API void hl_hoset(hlffi_hl_obj_map* m, vdynamic* key, vdynamic* value);
+HL_API bool hl_hoexists(hlffi_hl_obj_map* m, vdynamic* key);
+HL_API vdynamic* hl_hoget(hlffi_hl_obj_map* m, vdynamic* key);
+HL_API bool hl_horemove(hlffi_hl_obj_map* m, vdynamic* key);
+HL_API varray* hl_hokeys(hlffi_hl_obj_map* m);
+HL_API varray* hl_hovalues(hlffi_hl_obj_map* m);
+HL_API void hl_hoclear(hlffi_hl_obj_map* m);
+HL_API int hl_hosize(hlffi_hl_obj_map* m);
+
+typedef enum {
+    NATIVE_MAP_NONE = 0,
+    NATIVE_MAP_INT,         /* haxe.ds.IntMap    -> hl_int_map   */
+    NATIVE_MAP_STRING,      /* haxe.ds.StringMap -> hl_bytes_map */
+    NATIVE_MAP_OBJECT       /* haxe.ds.ObjectMap -> hl_obj_map   */
+} native_map_kind;
+
+typedef struct {
+    native_map_kind kind;
+    void* h;                /* Native hashtable of the map object */
+} native_map;
+
+/* Key in the representation of the hashtable it is used with */
+typedef struct {
+    int i;                  /* NATIVE_MAP_INT */
+    vbyte* bytes;           /* NATIVE_MAP_STRING: UTF-16, NUL-terminated */
+    vdynamic* obj;          /* NATIVE_MAP_OBJECT */
+} native_key;
+
+/* Resolve the native hashtable kind of a map class from its field 'h' */
+static native_map_kind map_layout_of(hl_type* t, int* h_offset) {
+    if (t->kind != HOBJ || !t->obj) return NATIVE_MAP_NONE;
+    if (!t->obj->rt) hl_get_obj_rt(t);
+
+    hl_field_lookup* l = obj_resolve_field(t->obj, hl_hash_utf8("h"));
+    if (!l || l->field_index < 0 || !l->t || l->t->kind != HABSTRACT || !l->t->abs_name) {
+        return NATIVE_MAP_NONE;
+    }
+
+    char name[32];
+    utostr(name, sizeof(name), l->t->abs_name);
+
+    native_map_kind kind = NATIVE_MAP_NONE;
+    if (strcmp(name, "hl_int_map") == 0) kind = NATIVE_MAP_INT;
+    else if (strcmp(name, "hl_bytes_map") == 0) kind = NATIVE_MAP_STRING;
+    else if (strcmp(name, "hl_obj_map") == 0) kind = NATIVE_MAP_OBJECT;
+
+    *h_offset = l->field_index;
+    return kind;
+}
+
+/* Same as map_layout_of(), remembered per class on the VM (vm may be NULL) */
+static native_map_kind map_layout_cached(hlffi_vm* vm, hl_type* t, int* h_offset) {
+    if (!vm) return map_layout_of(t, h_offset);
+
+    for (int i = 0; i < vm->map_type_count; i++) {
+        hlffi_map_type_entry* e = &vm->map_types[i];
+        if (e->type == t) {
+            *h_offset = e->h_offset;
+            return (native_map_kind)e->kind;
+        }
+    }
+
+    /* Negative results are remembered too, so other map classes skip the lookup */
+    int offset = 0;
+    native_map_kind kind = map_layout_of(t, &offset);
+
+    int slot = vm->map_type_count;
+    if (slot < HLFFI_MAP_TYPE_SLOTS) {
+        vm->map_type_count++;
+    } else {
+        slot = vm->map_type_next;
+        vm->map_type_next = (vm->map_type_next + 1) % HLFFI_MAP_TYPE_SLOTS;
+    }
+    vm->map_types[slot].type = t;
+    vm->map_types[slot].kind = kind;
+    vm->map_types[slot].h_offset = offset;
+
+    *h_offset = offset;
+    return kind;
+}
+
+/* Get the native hashtable behind a map value. Returns false if the map
+ * is not backed by one (or its hashtable is not allocated yet). */
+static bool native_map_of(hlffi_vm* vm, hlffi_value* map, native_map* out) {
+    vdynamic* obj = map ? map->hl_value : NULL;
+    if (!obj || !obj->t || obj->t->kind != HOBJ) return false;
+
+    int offset = 0;
+    out->kind = map_layout_cached(vm, obj->t, &offset);
+    if (out->kind == NATIVE_MAP_NONE) return false;
+
+    out->h = *(void**)((char*)obj + offset);
+    return out->h != NULL;
+}
+
+static void native_set(native_map* m, native_key* k, vdynamic* value) {
+    switch (m->kind) {
+        case NATIVE_MAP_INT: hl_hiset((hlffi_hl_int_map*)m->h, k->i, value); break;
+        case NATIVE_MAP_STRING: hl_hbset((hlffi_hl_bytes_map*)m->h, k->bytes, value); break;
+        case NATIVE_MAP_OBJECT: hl_hoset((hlffi_hl_obj_map*)m->h, k->obj, value); break;
+        default: break;
+    }
+}
+
+static vdynamic* native_get(native_map* m, native_key* k) {
+    switch (m->kind) {
+        case NATIVE_MAP_INT: return hl_higet((hlffi_hl_int_map*)m->h, k->i);
+        case NATIVE_MAP_STRING: return hl_hbget((hlffi_hl_bytes_map*)m->h, k->bytes);
+        case NATIVE_MAP_OBJECT: return hl_hoget((hlffi_hl_obj_map*)m->h, k->obj);
+        default: return NULL;
+    }
+}
+
+static bool native_exists(native_map* m, native_key* k) {
+    switch (m->kind) {
+        case NATIVE_MAP_INT: return hl_hiexists((hlffi_hl_int_map*)m->h, k->i);
+        case NATIVE_MAP_STRING: return hl_hbexists((hlffi_hl_bytes_map*)m->h, k->bytes);
+        case NATIVE_MAP_OBJECT: return hl_hoexists((hlffi_hl_obj_map*)m->h, k->obj);
+        default: return false;
+    }
+}
+
+static bool native_remove(native_map* m, native_key* k) {
+    switch (m->kind) {
+        case NATIVE_MAP_INT: return hl_hiremove((hlffi_hl_int_map*)m->h, k->i);
+        case NATIVE_MAP_STRING: return hl_hbremove((hlffi_hl_bytes_map*)m->h, k->bytes);
+        case NATIVE_MAP_OBJECT: return hl_horemove((hlffi_hl_obj_map*)m->h, k->obj);
+        default: return false;
+    }
+}
+
+static int native_size(native_map* m) {
+    switch (m->kind) {
+        case NATIVE_MAP_INT: return hl_hisize((hlffi_hl_int_map*)m->h);
+        case NATIVE_MAP_STRING: return hl_hbsize((hlffi_hl_bytes_map*)m->h);
+        case NATIVE_MAP_OBJECT: return hl_hosize((hlffi_hl_obj_map*)m->h);
+        default: return -1;
+    }
+}
+
+static void native_clear(native_map* m) {
+    switch (m->kind) {
+        case NATIVE_MAP_INT: hl_hiclear((hlffi_hl_int_map*)m->h); break;
+        case NATIVE_MAP_STRING: hl_hbclear((hlffi_hl_bytes_map*)m->h); break;
+        case NATIVE_MAP_OBJECT: hl_hoclear((hlffi_hl_obj_map*)m->h); break;
+        default: break;
+    }
+}
+
+/* ========== KEYS AND VALUES ========== */
+
+/* Convert an hlffi key to the map's key representation */
+static bool key_from_value(hlffi_vm* vm, native_map* m, hlffi_value* key, native_key* out) {
+    vdynamic* v = key->hl_value;
+
+    switch (m->kind) {
+        case NATIVE_MAP_INT:
+            if (v && (v->t->kind == HI32 || v->t->kind == HUI8 || v->t->kind == HUI16)) {
+                out->i = v->t->kind == HI32 ? v->v.i : v->t->kind == HUI8 ? v->v.ui8 : v->v.ui16;
+                return true;
+            }
+            set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "IntMap key must be an Int");
+            return false;
+
+        case NATIVE_MAP_STRING:
+            /* hlffi_value_string (HBYTES) and String objects share the vstring layout */
+            if (v && (v->t->kind == HBYTES || (vm->string_type && v->t == vm->string_type))) {
+                out->bytes = (vbyte*)((vstring*)v)->bytes;
+                return out->bytes != NULL;
+            }
+            set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "StringMap key must be a String");
+            return false;
+
+        case NATIVE_MAP_OBJECT:
+            out->obj = v;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/* Values are stored as Dynamic: strings from hlffi_value_string must be
+ * real String objects for Haxe's casts on the way out */
+static vdynamic* value_for_store(hlffi_vm* vm, hlffi_value* value) {
+    vdynamic* v = value ? value->hl_value : NULL;
+    if (v && v->t->kind == HBYTES && vm->string_type) {
+        v->t = vm->string_type;
+    }
+    return v;
+}
+
+/* UTF-16 copy of a C string key. Keys stored in a map must live in GC
+ * memory; lookup keys use the inline buffer when they fit. */
+typedef struct {
+    uchar* bytes;
+    bool heap;
+    uchar inline_buf[128];
+} utf16_key;
+
+static bool utf16_key_init(utf16_key* k, const char* str, bool for_store) {
+    int len = (int)strlen(str);
+    k->heap = false;
+
+    if (for_store) {
+        k->bytes = (uchar*)hl_gc_alloc_noptr((len + 1) << 1);
+    } else if (len < (int)(sizeof(k->inline_buf) / sizeof(uchar))) {
+        k->bytes = k->inline_buf;
+    } else {
+        k->bytes = (uchar*)malloc((len + 1) << 1);
+        k->heap = true;
+    }
+    if (!k->bytes) return false;
+
+    hl_from_utf8(k->bytes, len, str);
+    return true;
+}
+
+static void utf16_key_free(utf16_key* k) {
+    if (k->heap) free(k->bytes);
+}
+
+/* Allocate a temporary (unrooted) wrapper for a value read from a map */
+static hlffi_value* wrap_map_value(hlffi_vm* vm, vdynamic* v) {
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
+    if (!wrapped) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate value wrapper");
+        return NULL;
+    }
+    wrapped->hl_value = v;      /* NULL for a missing key or a null value */
+    wrapped->is_rooted = false;
+    return wrapped;
+}
+
+static vdynamic* box_int(int value) {
+    vdynamic* d = hl_alloc_dynamic(&hlt_i32);
+    d->v.i = value;
+    return d;
+}
+
+static vdynamic* box_float(double value) {
+    vdynamic* d = hl_alloc_dynamic(&hlt_f64);
+    d->v.d = value;
+    return d;
+}
+
+/* Typed reads reuse the hlffi_value unboxing rules */
+static int unbox_int(vdynamic* v, int fallback) {
+    struct hlffi_value tmp = { v, false };
+    return hlffi_value_as_int(&tmp, fallback);
+}
+
+static double unbox_float(vdynamic* v, double fallback) {
+    struct hlffi_value tmp = { v, false };
+    return hlffi_value_as_float(&tmp, fallback);
+}
+
+/* ========== MAP CREATION ========== */
 
 hlffi_value* hlffi_map_new(hlffi_vm* vm, hl_type* key_type, hl_type* value_type) {
     if (!vm) return NULL;
+    (void)value_type;  /* Values are stored as Dynamic whatever Map<K,V> says */
+
+    const char* class_name;
+    if (!key_type || key_type->kind == HDYN) {
+        class_name = "haxe.ds.ObjectMap";
+    } else if (key_type->kind == HI32 || key_type->kind == HUI8 || key_type->kind == HUI16) {
+        class_name = "haxe.ds.IntMap";
+    } else if (key_type->kind == HBYTES || (vm->string_type && key_type == vm->string_type)) {
+        class_name = "haxe.ds.StringMap";
+    } else if (key_type->kind == HOBJ || key_type->kind == HENUM || key_type->kind == HDYNOBJ) {
+        class_name = "haxe.ds.ObjectMap";
+    } else {
+        set_error(vm, HLFFI_ERROR_INVALID_TYPE, "Unsupported map key type");
+        return NULL;
+    }
+
+    hl_type* map_type = hlffi_type_index_lookup_class(vm, class_name);
+    if (!map_type) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "%s not found - use it from Haxe so it is compiled into the module", class_name);
+        vm->last_error = HLFFI_ERROR_TYPE_NOT_FOUND;
+        return NULL;
+    }
+
+    int offset = 0;
+    native_map_kind kind = map_layout_cached(vm, map_type, &offset);
+    if (kind == NATIVE_MAP_NONE) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg),
+                 "%s is not backed by a native hashtable", class_name);
+        vm->last_error = HLFFI_ERROR_INVALID_TYPE;
+        return NULL;
+    }
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    vdynamic* obj = hl_alloc_obj(map_type);
+    if (!obj) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate map");
+        return NULL;
+    }
 
-    /* Maps should be created in Haxe for now.
-     * Creating from C requires complex type instantiation. */
-    return NULL;
+    /* Same initialization as the Haxe constructor: h = new hl.types.XMap() */
+    void* h = kind == NATIVE_MAP_INT ? (void*)hl_hialloc()
+            : kind == NATIVE_MAP_STRING ? (void*)hl_hballoc()
+            : (void*)hl_hoalloc();
+    *(void**)((char*)obj + offset) = h;
+
+    /* Wrap in hlffi_value with GC root, like hlffi_new */
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
+    if (!wrapped) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate value wrapper");
+        return NULL;
+    }
+    wrapped->hl_value = obj;
+    hlffi_value_add_root(wrapped);
+
+    return wrapped;
 }
 
+/* ========== GENERIC KEY OPERATIONS ========== */
+
 bool hlffi_map_set(hlffi_vm* vm, hlffi_value* map, hlffi_value* key, hlffi_value* value) {
     if (!vm || !map || !key) return false;
 
+    native_map m;
+    if (native_map_of(vm, map, &m)) {
+        native_key k;
+        if (!key_from_value(vm, &m, key, &k)) return false;
+
+        HLFFI_UPDATE_STACK_TOP();  /* Insertion may grow the hashtable */
+        native_set(&m, &k, value_for_store(vm, value));
+        return true;
+    }
+
     /* Call map.set(key, value) via instance method */
     hlffi_value* args[] = {key, value};
     hlffi_value* result = hlffi_call_method(map, "set", 2, args);
@@ -33,6 +394,13 @@ bool hlffi_map_set(hlffi_vm* vm, hlffi_value* map, hlffi_value* key, hlffi_value
 hlffi_value* hlffi_map_get(hlffi_vm* vm, hlffi_value* map, hlffi_value* key) {
     if (!vm || !map || !key) return NULL;
 
+    native_map m;
+    if (native_map_of(vm, map, &m)) {
+        native_key k;
+        if (!key_from_value(vm, &m, key, &k)) return NULL;
+        return wrap_map_value(vm, native_get(&m, &k));
+    }
+
     /* Call map.get(key) */
     hlffi_value* args[] = {key};
     return hlffi_call_method(map, "get", 1, args);
@@ -41,6 +409,12 @@ hlffi_value* hlffi_map_get(hlffi_vm* vm, hlffi_value* map, hlffi_value* key) {
 bool hlffi_map_exists(hlffi_vm* vm, hlffi_value* map, hlffi_value* key) {
     if (!vm || !map || !key) return false;
 
+    native_map m;
+    if (native_map_of(vm, map, &m)) {
+        native_key k;
+        return key_from_value(vm, &m, key, &k) && native_exists(&m, &k);
+    }
+
     /* Call map.exists(key) */
     hlffi_value* args[] = {key};
     hlffi_value* result = hlffi_call_method(map, "exists", 1, args);
@@ -56,6 +430,12 @@ bool hlffi_map_exists(hlffi_vm* vm, hlffi_value* map, hlffi_value* key) {
 bool hlffi_map_remove(hlffi_vm* vm, hlffi_value* map, hlffi_value* key) {
     if (!vm || !map || !key) return false;
 
+    native_map m;
+    if (native_map_of(vm, map, &m)) {
+        native_key k;
+        return key_from_value(vm, &m, key, &k) && native_remove(&m, &k);
+    }
+
     /* Call map.remove(key) */
     hlffi_value* args[] = {key};
     hlffi_value* result = hlffi_call_method(map, "remove", 1, args);
@@ -68,6 +448,271 @@ bool hlffi_map_remove(hlffi_vm* vm, hlffi_value* map, hlffi_value* key) {
     return removed;
 }
 
+/* ========== INT KEYS ========== */
+
+/* Resolve a map that must be an IntMap (sets an error otherwise) */
+static bool int_map_of(hlffi_vm* vm, hlffi_value* map, native_map* m) {
+    if (native_map_of(vm, map, m) && m->kind == NATIVE_MAP_INT) return true;
+    set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Map is not an IntMap (Map<Int, T>)");
+    return false;
+}
+
+bool hlffi_map_int_set(hlffi_vm* vm, hlffi_value* map, int key, hlffi_value* value) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return false;
+
+    HLFFI_UPDATE_STACK_TOP();
+    hl_hiset((hlffi_hl_int_map*)m.h, key, value_for_store(vm, value));
+    return true;
+}
+
+hlffi_value* hlffi_map_int_get(hlffi_vm* vm, hlffi_value* map, int key) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return NULL;
+    return wrap_map_value(vm, hl_higet((hlffi_hl_int_map*)m.h, key));
+}
+
+bool hlffi_map_int_exists(hlffi_vm* vm, hlffi_value* map, int key) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return false;
+    return hl_hiexists((hlffi_hl_int_map*)m.h, key);
+}
+
+bool hlffi_map_int_remove(hlffi_vm* vm, hlffi_value* map, int key) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return false;
+    return hl_hiremove((hlffi_hl_int_map*)m.h, key);
+}
+
+bool hlffi_map_int_set_int(hlffi_vm* vm, hlffi_value* map, int key, int value) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return false;
+
+    HLFFI_UPDATE_STACK_TOP();
+    hl_hiset((hlffi_hl_int_map*)m.h, key, box_int(value));
+    return true;
+}
+
+int hlffi_map_int_get_int(hlffi_vm* vm, hlffi_value* map, int key, int fallback) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return fallback;
+    return unbox_int(hl_higet((hlffi_hl_int_map*)m.h, key), fallback);
+}
+
+bool hlffi_map_int_set_float(hlffi_vm* vm, hlffi_value* map, int key, double value) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return false;
+
+    HLFFI_UPDATE_STACK_TOP();
+    hl_hiset((hlffi_hl_int_map*)m.h, key, box_float(value));
+    return true;
+}
+
+double hlffi_map_int_get_float(hlffi_vm* vm, hlffi_value* map, int key, double fallback) {
+    native_map m;
+    if (!vm || !int_map_of(vm, map, &m)) return fallback;
+    return unbox_float(hl_higet((hlffi_hl_int_map*)m.h, key), fallback);
+}
+
+/* ========== STRING KEYS ========== */
+
+/* Resolve a map that must be a StringMap (sets an error otherwise) */
+static bool string_map_of(hlffi_vm* vm, hlffi_value* map, const char* key, native_map* m) {
+    if (!key) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Map key is NULL");
+        return false;
+    }
+    if (native_map_of(vm, map, m) && m->kind == NATIVE_MAP_STRING) return true;
+    set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Map is not a StringMap (Map<String, T>)");
+    return false;
+}
+
+/* Insert a value under a C string key (the key is copied to GC memory) */
+static bool string_map_store(hlffi_vm* vm, native_map* m, const char* key, vdynamic* value) {
+    utf16_key k;
+    if (!utf16_key_init(&k, key, true)) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate map key");
+        return false;
+    }
+    hl_hbset((hlffi_hl_bytes_map*)m->h, (vbyte*)k.bytes, value);
+    return true;
+}
+
+/* UTF-16 lookup key for a C string, without allocating from the GC */
+static bool string_map_key(hlffi_vm* vm, const char* key, utf16_key* k) {
+    if (utf16_key_init(k, key, false)) return true;
+    set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate map key");
+    return false;
+}
+
+static vdynamic* string_map_lookup(hlffi_vm* vm, native_map* m, const char* key) {
+    utf16_key k;
+    if (!string_map_key(vm, key, &k)) return NULL;
+    vdynamic* v = hl_hbget((hlffi_hl_bytes_map*)m->h, (vbyte*)k.bytes);
+    utf16_key_free(&k);
+    return v;
+}
+
+bool hlffi_map_str_set(hlffi_vm* vm, hlffi_value* map, const char* key, hlffi_value* value) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return false;
+
+    HLFFI_UPDATE_STACK_TOP();
+    return string_map_store(vm, &m, key, value_for_store(vm, value));
+}
+
+hlffi_value* hlffi_map_str_get(hlffi_vm* vm, hlffi_value* map, const char* key) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return NULL;
+    return wrap_map_value(vm, string_map_lookup(vm, &m, key));
+}
+
+bool hlffi_map_str_exists(hlffi_vm* vm, hlffi_value* map, const char* key) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return false;
+
+    utf16_key k;
+    if (!string_map_key(vm, key, &k)) return false;
+    bool found = hl_hbexists((hlffi_hl_bytes_map*)m.h, (vbyte*)k.bytes);
+    utf16_key_free(&k);
+    return found;
+}
+
+bool hlffi_map_str_remove(hlffi_vm* vm, hlffi_value* map, const char* key) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return false;
+
+    utf16_key k;
+    if (!string_map_key(vm, key, &k)) return false;
+    bool removed = hl_hbremove((hlffi_hl_bytes_map*)m.h, (vbyte*)k.bytes);
+    utf16_key_free(&k);
+    return removed;
+}
+
+bool hlffi_map_str_set_int(hlffi_vm* vm, hlffi_value* map, const char* key, int value) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return false;
+
+    HLFFI_UPDATE_STACK_TOP();
+    return string_map_store(vm, &m, key, box_int(value));
+}
+
+int hlffi_map_str_get_int(hlffi_vm* vm, hlffi_value* map, const char* key, int fallback) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return fallback;
+    return unbox_int(string_map_lookup(vm, &m, key), fallback);
+}
+
+bool hlffi_map_str_set_float(hlffi_vm* vm, hlffi_value* map, const char* key, double value) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return false;
+
+    HLFFI_UPDATE_STACK_TOP();
+    return string_map_store(vm, &m, key, box_float(value));
+}
+
+double hlffi_map_str_get_float(hlffi_vm* vm, hlffi_value* map, const char* key, double fallback) {
+    native_map m;
+    if (!vm || !string_map_of(vm, map, key, &m)) return fallback;
+    return unbox_float(string_map_lookup(vm, &m, key), fallback);
+}
+
+/* ========== BULK INSERT ========== */
+
+/* Box one element of a C value buffer as the Dynamic a map stores */
+static vdynamic* box_buffer_value(hlffi_vm* vm, hlffi_type_kind type, const void* values, int i) {
+    vdynamic* d;
+    switch (type) {
+        case HLFFI_TYPE_I32:
+            return box_int(((const int32_t*)values)[i]);
+        case HLFFI_TYPE_F32:
+            d = hl_alloc_dynamic(&hlt_f32);
+            d->v.f = ((const float*)values)[i];
+            return d;
+        case HLFFI_TYPE_F64:
+            return box_float(((const double*)values)[i]);
+        case HLFFI_TYPE_BOOL:
+            d = hl_alloc_dynamic(&hlt_bool);
+            d->v.b = ((const bool*)values)[i];
+            return d;
+        default:
+            return value_for_store(vm, ((hlffi_value* const*)values)[i]);
+    }
+}
+
+bool hlffi_map_set_many(hlffi_vm* vm, hlffi_value* map,
+                        hlffi_type_kind key_type, const void* keys,
+                        hlffi_type_kind value_type, const void* values, int n) {
+    if (!vm) return false;
+    if (!map || n < 0 || (n > 0 && (!keys || !values))) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Invalid map, buffers or count");
+        return false;
+    }
+
+    native_map m;
+    if (!native_map_of(vm, map, &m)) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Map is not backed by a native hashtable (IntMap/StringMap/ObjectMap)");
+        return false;
+    }
+
+    /* Validate both buffers once, before inserting anything */
+    bool keys_ok = key_type == HLFFI_TYPE_DYN ||
+                   (key_type == HLFFI_TYPE_I32 && m.kind == NATIVE_MAP_INT) ||
+                   (key_type == HLFFI_TYPE_BYTES && m.kind == NATIVE_MAP_STRING);
+    if (!keys_ok) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Key buffer type must be HLFFI_TYPE_I32 (IntMap), HLFFI_TYPE_BYTES (StringMap) or HLFFI_TYPE_DYN");
+        return false;
+    }
+    if (value_type != HLFFI_TYPE_I32 && value_type != HLFFI_TYPE_F32 && value_type != HLFFI_TYPE_F64 &&
+        value_type != HLFFI_TYPE_BOOL && value_type != HLFFI_TYPE_DYN) {
+        set_error(vm, HLFFI_ERROR_INVALID_TYPE,
+                  "Value buffer type must be HLFFI_TYPE_I32, F32, F64, BOOL or DYN");
+        return false;
+    }
+
+    HLFFI_UPDATE_STACK_TOP();  /* Boxing and key copies allocate from the GC */
+
+    for (int i = 0; i < n; i++) {
+        native_key k;
+        switch (key_type) {
+            case HLFFI_TYPE_I32:
+                k.i = ((const int32_t*)keys)[i];
+                break;
+            case HLFFI_TYPE_BYTES: {
+                const char* key = ((const char* const*)keys)[i];
+                utf16_key u;
+                if (!key) {
+                    set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Map key is NULL");
+                    return false;
+                }
+                if (!utf16_key_init(&u, key, true)) {
+                    set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate map key");
+                    return false;
+                }
+                k.bytes = (vbyte*)u.bytes;
+                break;
+            }
+            default: {
+                hlffi_value* key = ((hlffi_value* const*)keys)[i];
+                if (!key) {
+                    set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Map key is NULL");
+                    return false;
+                }
+                if (!key_from_value(vm, &m, key, &k)) return false;
+                break;
+            }
+        }
+
+        native_set(&m, &k, box_buffer_value(vm, value_type, values, i));
+    }
+
+    return true;
+}
+
+/* ========== ITERATION ========== */
+
 hlffi_value* hlffi_map_keys(hlffi_vm* vm, hlffi_value* map) {
     if (!vm || !map) return NULL;
 
@@ -82,18 +727,200 @@ hlffi_value* hlffi_map_values(hlffi_vm* vm, hlffi_value* map) {
     return hlffi_call_method(map, "iterator", 0, NULL);
 }
 
+/* Snapshot of the hashtable entries: keys and values in matching order,
+ * two allocations whatever the map size */
+static bool native_snapshot(hlffi_vm* vm, hlffi_value* map, native_map* m,
+                            varray** keys, varray** values) {
+    if (!native_map_of(vm, map, m)) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Map is not backed by a native hashtable (IntMap/StringMap/ObjectMap)");
+        return false;
+    }
+
+    switch (m->kind) {
+        case NATIVE_MAP_INT:
+            *keys = hl_hikeys((hlffi_hl_int_map*)m->h);
+            *values = hl_hivalues((hlffi_hl_int_map*)m->h);
+            break;
+        case NATIVE_MAP_STRING:
+            *keys = hl_hbkeys((hlffi_hl_bytes_map*)m->h);
+            *values = hl_hbvalues((hlffi_hl_bytes_map*)m->h);
+            break;
+        default:
+            *keys = hl_hokeys((hlffi_hl_obj_map*)m->h);
+            *values = hl_hovalues((hlffi_hl_obj_map*)m->h);
+            break;
+    }
+
+    if (!*keys || !*values || (*keys)->size != (*values)->size) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to snapshot map entries");
+        return false;
+    }
+    return true;
+}
+
+int hlffi_map_foreach(hlffi_vm* vm, hlffi_value* map, hlffi_map_entry_fn fn, void* userdata) {
+    if (!vm) return -1;
+    if (!map || !fn) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Map or callback is NULL");
+        return -1;
+    }
+
+    HLFFI_UPDATE_STACK_TOP();  /* Snapshot arrays live in this frame */
+
+    native_map m;
+    varray* keys;
+    varray* values;
+    if (!native_snapshot(vm, map, &m, &keys, &values)) return -1;
+
+    vdynamic** vals = hl_aptr(values, vdynamic*);
+
+    /* Borrowed views: the key is built on the stack, no per-entry allocation */
+    vdynamic int_key;
+    vstring str_key;
+    struct hlffi_value key = { NULL, false };
+    struct hlffi_value value = { NULL, false };
+
+    int visited = 0;
+    for (int i = 0; i < keys->size; i++) {
+        switch (m.kind) {
+            case NATIVE_MAP_INT:
+                int_key.t = &hlt_i32;
+                int_key.v.i = hl_aptr(keys, int)[i];
+                key.hl_value = &int_key;
+                break;
+            case NATIVE_MAP_STRING:
+                str_key.t = &hlt_bytes;
+                str_key.bytes = (uchar*)hl_aptr(keys, vbyte*)[i];
+                str_key.length = ustrlen(str_key.bytes);
+                key.hl_value = (vdynamic*)&str_key;
+                break;
+            default:
+                key.hl_value = hl_aptr(keys, vdynamic*)[i];
+                break;
+        }
+        value.hl_value = vals[i];
+
+        visited++;
+        if (!fn(&key, &value, userdata)) break;
+    }
+
+    return visited;
+}
+
+/* Store one exported value (null or non-numeric values export as 0) */
+static void export_value(vdynamic* v, hlffi_type_kind type, void* out, int i) {
+    struct hlffi_value tmp = { v, false };
+    switch (type) {
+        case HLFFI_TYPE_I32:  ((int32_t*)out)[i] = hlffi_value_as_int(&tmp, 0); break;
+        case HLFFI_TYPE_F32:  ((float*)out)[i] = (float)hlffi_value_as_float(&tmp, 0.0); break;
+        case HLFFI_TYPE_F64:  ((double*)out)[i] = hlffi_value_as_float(&tmp, 0.0); break;
+        case HLFFI_TYPE_BOOL: ((bool*)out)[i] = hlffi_value_as_bool(&tmp, false); break;
+        default: break;
+    }
+}
+
+/* Free the UTF-8 keys of a failed string export */
+static void free_exported_strings(char** out, int count) {
+    for (int i = 0; i < count; i++) {
+        free(out[i]);
+        out[i] = NULL;
+    }
+}
+
+int hlffi_map_export(hlffi_vm* vm, hlffi_value* map,
+                     hlffi_type_kind key_type, void* keys_out,
+                     hlffi_type_kind value_type, void* values_out, int cap) {
+    if (!vm) return -1;
+    if (!map || cap < 0) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Invalid map or capacity");
+        return -1;
+    }
+
+    /* Size query only: no snapshot needed */
+    if (!keys_out && !values_out) {
+        native_map m;
+        if (!native_map_of(vm, map, &m)) {
+            set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                      "Map is not backed by a native hashtable (IntMap/StringMap/ObjectMap)");
+            return -1;
+        }
+        return native_size(&m);
+    }
+
+    HLFFI_UPDATE_STACK_TOP();
+
+    native_map m;
+    varray* keys;
+    varray* values;
+    if (!native_snapshot(vm, map, &m, &keys, &values)) return -1;
+
+    /* Validate buffer types against the map before writing anything */
+    if (keys_out && !((key_type == HLFFI_TYPE_I32 && m.kind == NATIVE_MAP_INT) ||
+                      (key_type == HLFFI_TYPE_BYTES && m.kind == NATIVE_MAP_STRING))) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Key buffer type must be HLFFI_TYPE_I32 (IntMap) or HLFFI_TYPE_BYTES (StringMap)");
+        return -1;
+    }
+    if (values_out && value_type != HLFFI_TYPE_I32 && value_type != HLFFI_TYPE_F32 &&
+        value_type != HLFFI_TYPE_F64 && value_type != HLFFI_TYPE_BOOL) {
+        set_error(vm, HLFFI_ERROR_INVALID_TYPE,
+                  "Value buffer type must be HLFFI_TYPE_I32, F32, F64 or BOOL");
+        return -1;
+    }
+
+    int count = keys->size < cap ? keys->size : cap;
+
+    if (keys_out) {
+        if (m.kind == NATIVE_MAP_INT) {
+            memcpy(keys_out, hl_aptr(keys, int), (size_t)count * sizeof(int32_t));
+        } else {
+            char** out = (char**)keys_out;
+            vbyte** src = hl_aptr(keys, vbyte*);
+            for (int i = 0; i < count; i++) {
+                char* utf8 = hl_to_utf8((uchar*)src[i]);
+                out[i] = utf8 ? strdup(utf8) : NULL;
+                if (!out[i]) {
+                    free_exported_strings(out, i);
+                    set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to copy map key");
+                    return -1;
+                }
+            }
+        }
+    }
+
+    if (values_out) {
+        vdynamic** src = hl_aptr(values, vdynamic*);
+        for (int i = 0; i < count; i++) {
+            export_value(src[i], value_type, values_out, i);
+        }
+    }
+
+    return count;
+}
+
+/* ========== SIZE / CLEAR ========== */
+
 int hlffi_map_size(hlffi_value* map) {
-    if (!map) return -1;
+    native_map m;
+    if (!native_map_of(NULL, map, &m)) return -1;
 
-    /* Maps don't have direct size(), need to iterate or use Lambda.count()
-     * Return -1 to indicate not directly available */
-    return -1;
+    /* Entry count kept by the hashtable, O(1) */
+    return native_size(&m);
 }
 
 bool hlffi_map_clear(hlffi_value* map) {
     if (!map) return false;
 
-    /* Map.clear() exists in some Haxe versions
-     * Not implemented for now */
-    return false;
+    native_map m;
+    if (native_map_of(NULL, map, &m)) {
+        native_clear(&m);
+        return true;
+    }
+
+    /* Call map.clear() (Haxe 4+) */
+    hlffi_value* result = hlffi_call_method(map, "clear", 0, NULL);
+    if (!result) return false;
+    hlffi_value_free(result);
+    return true;
 }
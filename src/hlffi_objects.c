@@ -36,25 +36,8 @@ static hl_type* find_type_by_name(hlffi_vm* vm, const char* class_name) {
     return (hl_type*)hlffi_find_type(vm, class_name);
 
 #else
-    /*=== JIT Mode: Scan code->types[] ===*/
-    if (!vm->module || !vm->module->code) return NULL;
-
-    hl_code* code = vm->module->code;
-
-    /* Hash the class name for comparison */
-    int class_hash = hl_hash_utf8(class_name);
-
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type* t = code->types + i;
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            char* type_name = hl_to_utf8(t->obj->name);
-            int type_hash = type_name ? hl_hash_utf8(type_name) : 0;
-            if (type_name && type_hash == class_hash) {
-                return t;
-            }
-        }
-    }
-    return NULL;
+    /*=== JIT Mode: Type name index ===*/
+    return hlffi_type_index_lookup_class(vm, class_name);
 
 #endif /* HLFFI_HLC_MODE */
 }
@@ -275,6 +258,7 @@ hlffi_value* hlffi_new(hlffi_vm* vm, const char* class_name, int argc, hlffi_val
             vdynamic* ctor_result = hl_dyn_call_safe(&cl, hl_args, total_args, &isException);
 
             if (isException) {
+                hlffi_exception_capture(vm, ctor_result);
                 set_obj_error(vm, "Exception thrown in constructor");
 #ifdef HLFFI_DEBUG
                 if (ctor_result) {
@@ -299,15 +283,14 @@ hlffi_value* hlffi_new(hlffi_vm* vm, const char* class_name, int argc, hlffi_val
     /* If no constructor found, that's OK - some classes may not have one */
 
     /* Step 5: Wrap in hlffi_value with GC root */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) {
         set_obj_error(vm, "Failed to allocate value wrapper");
         return NULL;
     }
 
     wrapped->hl_value = (vdynamic*)instance;
-    wrapped->is_rooted = true;
-    hl_add_root(&wrapped->hl_value);  /* Keep object alive! */
+    hlffi_value_add_root(wrapped);  /* Keep object alive! */
 
     return wrapped;
 
@@ -341,7 +324,7 @@ hlffi_value* hlffi_get_field(hlffi_value* obj, const char* field_name) {
     }
 
     /* Use type-specific getter (Phase 3 pattern!) */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(NULL);
     if (!wrapped) return NULL;
 
     wrapped->is_rooted = false;  /* Borrowed reference from object */
@@ -536,7 +519,7 @@ hlffi_value* hlffi_call_method(hlffi_value* obj, const char* method_name, int ar
 #endif
 
                             /* Wrap result */
-                            hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+                            hlffi_value* wrapped = hlffi_value_alloc(NULL);
                             if (!wrapped) return NULL;
 
                             /* For boolean/int returns, the value is in ret_val
@@ -608,7 +591,7 @@ hlffi_value* hlffi_call_method(hlffi_value* obj, const char* method_name, int ar
     }
 
     /* Wrap result (including NULL for null strings/objects) */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(NULL);
     if (!wrapped) return NULL;
 
     wrapped->hl_value = result;  /* Can be NULL for null strings/objects */
@@ -8,13 +8,38 @@
  * - hl_module_patch(m, new_code) patches the running module
  */
 
+/* Windows headers must be included BEFORE hlffi_internal.h to avoid type conflicts */
+#ifdef _WIN32
+    #include <windows.h>
+    #include <process.h>
+#endif
+
 #include "hlffi_internal.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    #include <errno.h>
+    #include <time.h>
+    #define HLFFI_RELOAD_INOTIFY 1
+#elif !defined(_WIN32)
+    #include <time.h>
+#endif
+
+#ifndef _WIN32
+    #include <pthread.h>
+#endif
 
 #ifndef HLFFI_HLC_MODE
-/* Forward declaration for bytecode loading (JIT mode only) */
-static hl_code* load_code_from_file(const char* path, char** error_msg);
+/* Forward declarations (JIT mode only) */
+static char* read_file_data(const char* path, int* size, char** error_msg);
+static double now_ms(void);
+static hlffi_error_code reload_preconditions(hlffi_vm* vm);
+static void apply_code(hlffi_vm* vm, hl_code* code, hlffi_reload_stats* stats);
 #endif
 
 /* ========== HOT RELOAD API ========== */
@@ -61,16 +86,8 @@ hlffi_error_code hlffi_reload_module(hlffi_vm* vm, const char* path) {
 #else
     /*=== JIT Mode: Hot reload supported ===*/
 
-    if (!vm->module_loaded) {
-        hlffi_set_error(vm, HLFFI_ERROR_NOT_INITIALIZED, "No module loaded");
-        return HLFFI_ERROR_NOT_INITIALIZED;
-    }
-
-    if (!vm->hot_reload_enabled) {
-        hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT,
-                       "Hot reload not enabled - call hlffi_enable_hot_reload() before loading");
-        return HLFFI_ERROR_INVALID_ARGUMENT;
-    }
+    hlffi_error_code check = reload_preconditions(vm);
+    if (check != HLFFI_OK) return check;
 
     /* Use the original loaded file if no path specified */
     const char* reload_path = path ? path : vm->loaded_file;
@@ -79,26 +96,32 @@ hlffi_error_code hlffi_reload_module(hlffi_vm* vm, const char* path) {
         return HLFFI_ERROR_INVALID_ARGUMENT;
     }
 
+    hlffi_reload_stats stats = {0};
+    double start = now_ms();
+
     /* Load new bytecode */
     char* error_msg = NULL;
-    hl_code* new_code = load_code_from_file(reload_path, &error_msg);
-    if (!new_code) {
+    int size = 0;
+    char* data = read_file_data(reload_path, &size, &error_msg);
+    if (!data) {
         hlffi_set_error(vm, HLFFI_ERROR_FILE_NOT_FOUND,
                        error_msg ? error_msg : "Failed to load bytecode for reload");
         return HLFFI_ERROR_FILE_NOT_FOUND;
     }
+    double read_done = now_ms();
 
-    /* Patch the running module */
-    bool changed = hl_module_patch(vm->module, new_code);
-
-    /* Free the code (hl_module_patch copies what it needs) */
-    hl_code_free(new_code);
-
-    /* Call reload callback if registered */
-    if (vm->reload_callback) {
-        vm->reload_callback(vm, changed, vm->reload_userdata);
+    hl_code* new_code = hl_code_read((unsigned char*)data, size, &error_msg);
+    free(data);
+    if (!new_code) {
+        hlffi_set_error(vm, HLFFI_ERROR_INVALID_BYTECODE,
+                       error_msg ? error_msg : "Failed to parse bytecode for reload");
+        return HLFFI_ERROR_INVALID_BYTECODE;
     }
 
+    stats.read_ms = read_done - start;
+    stats.parse_ms = now_ms() - read_done;
+    apply_code(vm, new_code, &stats);
+
     hlffi_set_error(vm, HLFFI_OK, NULL);
     return HLFFI_OK;
 #endif /* HLFFI_HLC_MODE */
@@ -121,16 +144,11 @@ hlffi_error_code hlffi_reload_module_memory(hlffi_vm* vm, const void* data, size
         return HLFFI_ERROR_INVALID_ARGUMENT;
     }
 
-    if (!vm->module_loaded) {
-        hlffi_set_error(vm, HLFFI_ERROR_NOT_INITIALIZED, "No module loaded");
-        return HLFFI_ERROR_NOT_INITIALIZED;
-    }
+    hlffi_error_code check = reload_preconditions(vm);
+    if (check != HLFFI_OK) return check;
 
-    if (!vm->hot_reload_enabled) {
-        hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT,
-                       "Hot reload not enabled - call hlffi_enable_hot_reload() before loading");
-        return HLFFI_ERROR_INVALID_ARGUMENT;
-    }
+    hlffi_reload_stats stats = {0};
+    double start = now_ms();
 
     /* Parse bytecode from memory */
     char* error_msg = NULL;
@@ -141,16 +159,8 @@ hlffi_error_code hlffi_reload_module_memory(hlffi_vm* vm, const void* data, size
         return HLFFI_ERROR_INVALID_BYTECODE;
     }
 
-    /* Patch the running module */
-    bool changed = hl_module_patch(vm->module, new_code);
-
-    /* Free the code */
-    hl_code_free(new_code);
-
-    /* Call reload callback if registered */
-    if (vm->reload_callback) {
-        vm->reload_callback(vm, changed, vm->reload_userdata);
-    }
+    stats.parse_ms = now_ms() - start;
+    apply_code(vm, new_code, &stats);
 
     hlffi_set_error(vm, HLFFI_OK, NULL);
     return HLFFI_OK;
@@ -163,6 +173,157 @@ void hlffi_set_reload_callback(hlffi_vm* vm, hlffi_reload_callback callback, voi
     vm->reload_userdata = userdata;
 }
 
+void hlffi_set_reload_timing(hlffi_vm* vm, int poll_ms, int debounce_ms) {
+    if (!vm) return;
+    if (poll_ms >= 0) vm->reload_poll_ms = poll_ms;
+    if (debounce_ms >= 0) vm->reload_debounce_ms = debounce_ms;
+    vm->next_poll_ms = 0;
+}
+
+int hlffi_get_reload_fd(hlffi_vm* vm) {
+    return vm ? vm->watch_fd : -1;
+}
+
+/* ========== FILE WATCH ========== */
+
+/*
+ * hlffi_check_reload() is meant to be called every frame, so it must not
+ * touch the filesystem every frame. Between checks it only reads the
+ * monotonic clock (no syscall on Linux/Windows). A check is one syscall:
+ * - Linux: a non-blocking read() draining an inotify watch on the file's
+ *   directory (compilers and editors often write a temp file and rename it
+ *   over the original, which a watch on the file itself would miss)
+ * - elsewhere: one stat(), comparing modification time (ns where available)
+ *   and size
+ * A detected change is only acted on after reload_debounce_ms without
+ * further activity, so a bytecode file still being written is not loaded
+ * half-way.
+ */
+
+#ifndef HLFFI_HLC_MODE
+/* Milliseconds from a monotonic high-resolution clock (watch and phase timings) */
+static double now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+#endif /* !HLFFI_HLC_MODE */
+
+/* Modification time (ns) and size of path; false if it cannot be read */
+static bool file_stamp(const char* path, int64_t* mtime, int64_t* size) {
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+
+#if defined(__linux__)
+    *mtime = (int64_t)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+    *mtime = (int64_t)st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+#else
+    *mtime = (int64_t)st.st_mtime * 1000000000LL;
+#endif
+    *size = (int64_t)st.st_size;
+    return true;
+}
+
+/* Record the current version of the file as seen */
+static void watch_observe(hlffi_vm* vm) {
+    int64_t mtime = 0, size = 0;
+    if (file_stamp(vm->loaded_file, &mtime, &size)) {
+        vm->file_mtime = mtime;
+        vm->file_size = size;
+    }
+}
+
+void hlffi_reload_watch_start(hlffi_vm* vm) {
+    if (!vm || !vm->loaded_file) return;
+
+    hlffi_reload_watch_stop(vm);
+    watch_observe(vm);
+    vm->change_pending = false;
+    vm->next_poll_ms = 0;
+
+#ifdef HLFFI_RELOAD_INOTIFY
+    /* Watch the directory and filter on the file name */
+    char dir[4096];
+    const char* slash = strrchr(vm->loaded_file, '/');
+    size_t len = slash ? (size_t)(slash - vm->loaded_file) : 0;
+    if (len >= sizeof(dir)) return;
+    if (slash && len == 0) len = 1;  /* File in the root directory */
+    if (slash) {
+        memcpy(dir, vm->loaded_file, len);
+        dir[len] = 0;
+    } else {
+        strcpy(dir, ".");
+    }
+
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) return;  /* Fall back to stat() polling */
+
+    if (inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE) < 0) {
+        close(fd);
+        return;
+    }
+    vm->watch_fd = fd;
+#endif
+}
+
+void hlffi_reload_watch_stop(hlffi_vm* vm) {
+    if (!vm) return;
+
+#ifdef HLFFI_RELOAD_INOTIFY
+    if (vm->watch_fd >= 0) {
+        close(vm->watch_fd);
+    }
+#endif
+    vm->watch_fd = -1;
+}
+
+#ifndef HLFFI_HLC_MODE
+/* One check: true if the file shows signs of being written since the last one */
+static bool watch_poll(hlffi_vm* vm) {
+#ifdef HLFFI_RELOAD_INOTIFY
+    if (vm->watch_fd >= 0) {
+        const char* slash = strrchr(vm->loaded_file, '/');
+        const char* name = slash ? slash + 1 : vm->loaded_file;
+        bool activity = false;
+
+        char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        for (;;) {
+            ssize_t n = read(vm->watch_fd, buf, sizeof(buf));
+            if (n <= 0) break;  /* EAGAIN: drained */
+
+            for (char* p = buf; p < buf + n; ) {
+                struct inotify_event* ev = (struct inotify_event*)p;
+                if ((ev->mask & IN_Q_OVERFLOW) || (ev->len && strcmp(ev->name, name) == 0)) {
+                    activity = true;
+                }
+                p += sizeof(struct inotify_event) + ev->len;
+            }
+        }
+        return activity;
+    }
+#endif
+
+    int64_t mtime = 0, size = 0;
+    if (!file_stamp(vm->loaded_file, &mtime, &size)) {
+        return false;  /* Missing (mid-replace): wait for it to reappear */
+    }
+    if (mtime == vm->file_mtime && size == vm->file_size) {
+        return false;
+    }
+    vm->file_mtime = mtime;
+    vm->file_size = size;
+    return true;
+}
+#endif /* !HLFFI_HLC_MODE */
+
 bool hlffi_check_reload(hlffi_vm* vm) {
 #ifdef HLFFI_HLC_MODE
     /*=== HLC Mode: Hot reload not supported ===*/
@@ -175,35 +336,254 @@ bool hlffi_check_reload(hlffi_vm* vm) {
     if (!vm->hot_reload_enabled || !vm->module_loaded) return false;
     if (!vm->loaded_file) return false;
 
-    /* Check file modification time */
-    FILE* f = fopen(vm->loaded_file, "rb");
-    if (!f) return false;
+    /* Between checks: clock only, no filesystem access */
+    double now = now_ms();
+    if (vm->change_pending) {
+        if (now - vm->change_time_ms < vm->reload_debounce_ms) return false;
+    } else if (now < vm->next_poll_ms) {
+        return false;
+    }
+    vm->next_poll_ms = now + vm->reload_poll_ms;
 
-    /* Get current file time (simple approach: use file size as proxy) */
-    fseek(f, 0, SEEK_END);
-    int current_time = (int)ftell(f);
-    fclose(f);
+    if (watch_poll(vm)) {
+        /* Still being written: (re)start the quiet period */
+        vm->change_pending = true;
+        vm->change_time_ms = now;
+        return false;
+    }
+    if (!vm->change_pending) {
+        return false;
+    }
 
-    if (current_time != vm->file_time && vm->file_time != 0) {
-        /* File changed - trigger reload */
-        hlffi_error_code result = hlffi_reload_module(vm, NULL);
-        if (result == HLFFI_OK) {
-            vm->file_time = current_time;
-            return true;
-        }
+    /* Quiet for the debounce period - reload the settled file */
+    vm->change_pending = false;
+    if (vm->watch_fd >= 0) {
+        watch_observe(vm);
     }
+    return hlffi_reload_module(vm, NULL) == HLFFI_OK;
+#endif /* HLFFI_HLC_MODE */
+}
 
-    return false;
+/* ========== ASYNC RELOAD ========== */
+
+/*
+ * hlffi_reload_module_async() moves the slow part of a reload - reading the
+ * file and hl_code_read() - to a worker thread. hl_code_read only uses the
+ * code's own allocator (no GC, no VM state), so the worker does not register
+ * with HashLink. When parsing is done the worker only sets job->done; it
+ * never touches the VM or its message queue (which can be full or torn
+ * down). The host wakes an idle VM thread when it publishes the job, and
+ * the VM thread polls until the result is picked up at its next safe point:
+ * - hlffi_update() (NON_THREADED mode)
+ * - the VM thread's message loop (THREADED mode, thread running)
+ * Only hl_module_patch, the index rebuild and the callback run on the VM
+ * thread.
+ */
+
+/* vm->reload_job is read by the VM thread and set by the host (THREADED mode) */
+#ifdef _WIN32
+    #define job_load(p)        InterlockedCompareExchangePointer((PVOID volatile*)(p), NULL, NULL)
+    #define job_store(p, v)    InterlockedExchangePointer((PVOID volatile*)(p), (PVOID)(v))
+    #define job_store_done(p)  InterlockedExchange((LONG volatile*)(p), 1)
+    #define job_load_done(p)   InterlockedCompareExchange((LONG volatile*)(p), 0, 0)
+#else
+    #define job_load(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define job_store(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define job_store_done(p)  __atomic_store_n((p), 1, __ATOMIC_RELEASE)
+    #define job_load_done(p)   __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#endif
+
+#ifndef HLFFI_HLC_MODE
+
+/* One in-flight async reload (vm->reload_job) */
+typedef struct hlffi_reload_job {
+    hlffi_vm* vm;
+    char* path;             /* Owned copy */
+    hl_code* code;          /* Parsed bytecode, NULL on error */
+    char error[256];
+    double read_ms;
+    double parse_ms;
+    int done;               /* Set by the worker once code/error are final */
+#ifdef _WIN32
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+} hlffi_reload_job;
+
+#ifdef _WIN32
+static unsigned __stdcall reload_worker(void* param)
+#else
+static void* reload_worker(void* param)
+#endif
+{
+    hlffi_reload_job* job = (hlffi_reload_job*)param;
+
+    double start = now_ms();
+    char* error_msg = NULL;
+    int size = 0;
+    char* data = read_file_data(job->path, &size, &error_msg);
+    double read_done = now_ms();
+    job->read_ms = read_done - start;
+
+    if (data) {
+        job->code = hl_code_read((unsigned char*)data, size, &error_msg);
+        job->parse_ms = now_ms() - read_done;
+        free(data);
+    }
+    if (!job->code) {
+        snprintf(job->error, sizeof(job->error), "%s",
+                 error_msg ? error_msg : "Failed to load bytecode for reload");
+    }
+
+    /* Publish; the VM thread applies it at its next safe point */
+    job_store_done(&job->done);
+
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+static void reload_job_join(hlffi_reload_job* job) {
+#ifdef _WIN32
+    WaitForSingleObject(job->thread, INFINITE);
+    CloseHandle(job->thread);
+#else
+    pthread_join(job->thread, NULL);
+#endif
+}
+
+static void reload_job_free(hlffi_reload_job* job) {
+    if (job->code) hl_code_free(job->code);
+    free(job->path);
+    free(job);
+}
+
+#endif /* !HLFFI_HLC_MODE */
+
+hlffi_error_code hlffi_reload_module_async(hlffi_vm* vm, const char* path) {
+    if (!vm) return HLFFI_ERROR_NULL_VM;
+
+#ifdef HLFFI_HLC_MODE
+    /*=== HLC Mode: Hot reload not supported ===*/
+    (void)path;
+    hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT,
+                   "Hot reload not supported in HLC mode - code is statically linked");
+    return HLFFI_ERROR_INVALID_ARGUMENT;
+#else
+    /*=== JIT Mode: Hot reload supported ===*/
+
+    hlffi_error_code check = reload_preconditions(vm);
+    if (check != HLFFI_OK) return check;
+
+    const char* reload_path = path ? path : vm->loaded_file;
+    if (!reload_path) {
+        hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "No file path for reload");
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (job_load(&vm->reload_job)) {
+        hlffi_set_error(vm, HLFFI_ERROR_RELOAD_FAILED, "An async reload is already in progress");
+        return HLFFI_ERROR_RELOAD_FAILED;
+    }
+
+    hlffi_reload_job* job = (hlffi_reload_job*)calloc(1, sizeof(hlffi_reload_job));
+    if (job) job->path = strdup(reload_path);
+    if (!job || !job->path) {
+        free(job);
+        hlffi_set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate reload job");
+        return HLFFI_ERROR_OUT_OF_MEMORY;
+    }
+    job->vm = vm;
+
+#ifdef _WIN32
+    job->thread = (HANDLE)_beginthreadex(NULL, 0, reload_worker, job, 0, NULL);
+    bool started = job->thread != NULL;
+#else
+    bool started = pthread_create(&job->thread, NULL, reload_worker, job) == 0;
+#endif
+    if (!started) {
+        reload_job_free(job);
+        hlffi_set_error(vm, HLFFI_ERROR_THREAD_START_FAILED, "Failed to start reload thread");
+        return HLFFI_ERROR_THREAD_START_FAILED;
+    }
+
+    /* Publish after the thread handle is stored: the VM thread joins it */
+    job_store(&vm->reload_job, job);
+    hlffi_thread_wake(vm);
+    hlffi_set_error(vm, HLFFI_OK, NULL);
+    return HLFFI_OK;
 #endif /* HLFFI_HLC_MODE */
 }
 
+bool hlffi_reload_pending(hlffi_vm* vm) {
+    return vm && job_load(&vm->reload_job) != NULL;
+}
+
+bool hlffi_get_reload_stats(hlffi_vm* vm, hlffi_reload_stats* out) {
+    if (!vm || !out || !vm->reload_stats_valid) return false;
+    *out = vm->reload_stats;
+    return true;
+}
+
+void hlffi_reload_apply_pending(hlffi_vm* vm) {
+#ifndef HLFFI_HLC_MODE
+    hlffi_reload_job* job = (hlffi_reload_job*)job_load(&vm->reload_job);
+    if (!job || !job_load_done(&job->done)) return;
+
+    /* The worker has finished: joining only reclaims the thread */
+    reload_job_join(job);
+    job_store(&vm->reload_job, NULL);
+
+    hlffi_reload_stats stats = {0};
+    stats.async = true;
+    stats.read_ms = job->read_ms;
+    stats.parse_ms = job->parse_ms;
+
+    if (job->code) {
+        hl_code* code = job->code;
+        job->code = NULL;  /* apply_code frees it */
+        apply_code(vm, code, &stats);
+        hlffi_set_error(vm, HLFFI_OK, NULL);
+    } else {
+        /* No caller to return an error to: report through the callback */
+        vm->reload_stats = stats;
+        vm->reload_stats_valid = true;
+        hlffi_set_error(vm, HLFFI_ERROR_RELOAD_FAILED, job->error);
+        if (vm->reload_callback) {
+            vm->reload_callback(vm, false, vm->reload_userdata);
+        }
+    }
+
+    reload_job_free(job);
+#else
+    (void)vm;
+#endif
+}
+
+void hlffi_reload_async_cancel(hlffi_vm* vm) {
+#ifndef HLFFI_HLC_MODE
+    hlffi_reload_job* job = (hlffi_reload_job*)job_load(&vm->reload_job);
+    if (!job) return;
+
+    /* Wait for the parse to finish, then drop its result */
+    reload_job_join(job);
+    job_store(&vm->reload_job, NULL);
+    reload_job_free(job);
+#else
+    (void)vm;
+#endif
+}
+
 #ifndef HLFFI_HLC_MODE
 /* ========== INTERNAL HELPERS (JIT Mode Only) ========== */
 
 /**
- * Load bytecode from file (same as in hlffi_lifecycle.c)
+ * Read a whole file into a malloc'd buffer (caller frees)
  */
-static hl_code* load_code_from_file(const char* path, char** error_msg) {
+static char* read_file_data(const char* path, int* size, char** error_msg) {
     FILE* f = fopen(path, "rb");
     if (!f) {
         if (error_msg) *error_msg = "Failed to open file";
@@ -212,11 +592,11 @@ static hl_code* load_code_from_file(const char* path, char** error_msg) {
 
     /* Get file size */
     fseek(f, 0, SEEK_END);
-    int size = (int)ftell(f);
+    int fsize = (int)ftell(f);
     fseek(f, 0, SEEK_SET);
 
     /* Read file data */
-    char* fdata = (char*)malloc(size);
+    char* fdata = (char*)malloc(fsize > 0 ? fsize : 1);
     if (!fdata) {
         fclose(f);
         if (error_msg) *error_msg = "Out of memory";
@@ -224,8 +604,8 @@ static hl_code* load_code_from_file(const char* path, char** error_msg) {
     }
 
     int pos = 0;
-    while (pos < size) {
-        int r = (int)fread(fdata + pos, 1, size - pos, f);
+    while (pos < fsize) {
+        int r = (int)fread(fdata + pos, 1, fsize - pos, f);
         if (r <= 0) {
             free(fdata);
             fclose(f);
@@ -236,10 +616,66 @@ static hl_code* load_code_from_file(const char* path, char** error_msg) {
     }
     fclose(f);
 
-    /* Parse bytecode */
-    hl_code* code = hl_code_read((unsigned char*)fdata, size, error_msg);
-    free(fdata);
+    *size = fsize;
+    return fdata;
+}
+
+static hlffi_error_code reload_preconditions(hlffi_vm* vm) {
+    if (!vm->module_loaded) {
+        hlffi_set_error(vm, HLFFI_ERROR_NOT_INITIALIZED, "No module loaded");
+        return HLFFI_ERROR_NOT_INITIALIZED;
+    }
 
-    return code;
+    if (!vm->hot_reload_enabled) {
+        hlffi_set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT,
+                       "Hot reload not enabled - call hlffi_enable_hot_reload() before loading");
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
+
+    return HLFFI_OK;
+}
+
+/**
+ * Patch the running module with parsed code (VM thread), then notify.
+ * stats arrives with read/parse timings; patch/callback/stall are added here
+ * and the result is published as vm->reload_stats.
+ */
+static void apply_code(hlffi_vm* vm, hl_code* code, hlffi_reload_stats* stats) {
+    double start = now_ms();
+
+    /* Patch the running module */
+    bool changed = hl_module_patch(vm->module, code);
+
+    /* Free the code (hl_module_patch copies what it needs) */
+    hl_code_free(code);
+
+    /* hl_module_patch keeps vm->module->code, so the index gets the same
+     * names back; the rebuild only resets derived per-type caches (map
+     * layouts, the String type) */
+    hlffi_type_index_build(vm);
+
+    /* Cached calls/fields re-resolve lazily on their next use */
+    vm->module_generation++;
+
+    double patched = now_ms();
+    stats->patch_ms = patched - start;
+    stats->callback_ms = 0.0;
+    stats->changed = changed;
+    stats->success = true;
+    vm->reload_stats = *stats;  /* Readable from the callback */
+    vm->reload_stats_valid = true;
+
+    /* Call reload callback if registered */
+    if (vm->reload_callback) {
+        vm->reload_callback(vm, changed, vm->reload_userdata);
+    }
+
+    /* Time the VM thread spent blocked: everything for a synchronous
+     * reload, only patch + callback when parsed off-thread */
+    vm->reload_stats.callback_ms = now_ms() - patched;
+    vm->reload_stats.stall_ms = vm->reload_stats.patch_ms + vm->reload_stats.callback_ms;
+    if (!stats->async) {
+        vm->reload_stats.stall_ms += stats->read_ms + stats->parse_ms;
+    }
 }
 #endif /* !HLFFI_HLC_MODE */
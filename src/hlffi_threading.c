@@ -6,7 +6,8 @@
  * ARCHITECTURE:
  * - Main thread: Enqueues messages and waits for responses
  * - VM thread: Processes messages in a loop, calls into HashLink
- * - Message queue: Thread-safe circular buffer with mutex/condvar
+ * - Message queue: Lock-free multi-producer/single-consumer queue; the
+ *   mutex/condvar is only used to wake the VM thread when it is idle
  *
  * USAGE (Mode 2 - THREADED):
  *   hlffi_vm* vm = hlffi_create();
@@ -45,13 +46,57 @@
     #define pthread_cond_wait(c, m) SleepConditionVariableCS(c, m, INFINITE)
     #define pthread_cond_signal(c) WakeConditionVariable(c)
     #define pthread_cond_broadcast(c) WakeAllConditionVariable(c)
+    #define cond_wait_ms(c, m, ms) SleepConditionVariableCS(c, m, (DWORD)(ms))
 #else
     #include <pthread.h>
+    #include <time.h>
+
+    /* pthread_cond_timedwait with a relative timeout */
+    static void cond_wait_ms(pthread_cond_t* c, pthread_mutex_t* m, int ms) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += ms / 1000;
+        ts.tv_nsec += (long)(ms % 1000) * 1000000L;
+        if (ts.tv_nsec >= 1000000000L) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(c, m, &ts);
+    }
+#endif
+
+/* ========== ATOMICS ========== */
+
+#ifdef _WIN32
+    #define atomic_load_ptr(p)          InterlockedCompareExchangePointer((PVOID volatile*)(p), NULL, NULL)
+    #define atomic_xchg_ptr(p, v)       InterlockedExchangePointer((PVOID volatile*)(p), (PVOID)(v))
+    #define atomic_cas_ptr(p, exp, des) (InterlockedCompareExchangePointer((PVOID volatile*)(p), (PVOID)(des), (PVOID)(exp)) == (PVOID)(exp))
+    #define atomic_load_int(p)          InterlockedCompareExchange((LONG volatile*)(p), 0, 0)
+    #define atomic_store_int(p, v)      InterlockedExchange((LONG volatile*)(p), (LONG)(v))
+    #define atomic_add_int(p, v)        InterlockedExchangeAdd((LONG volatile*)(p), (LONG)(v))
+#else
+    #define atomic_load_ptr(p)          __atomic_load_n((p), __ATOMIC_SEQ_CST)
+    #define atomic_xchg_ptr(p, v)       __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+    #define atomic_cas_ptr(p, exp, des) __atomic_compare_exchange_n((p), &(exp), (des), true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+    #define atomic_load_int(p)          __atomic_load_n((p), __ATOMIC_SEQ_CST)
+    #define atomic_store_int(p, v)      __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+    #define atomic_add_int(p, v)        __atomic_fetch_add((p), (v), __ATOMIC_SEQ_CST)
 #endif
 
 /* ========== MESSAGE QUEUE ========== */
 
-#define HLFFI_MSG_QUEUE_SIZE 256
+/*
+ * Lock-free MPSC queue:
+ * - Producers push onto an atomic LIFO list with a single CAS (no lock, no
+ *   fixed capacity - the queue grows with the number of pending messages).
+ * - The VM thread takes the whole list with one atomic exchange and reverses
+ *   it, draining every pending message as one FIFO batch.
+ * - The VM thread only sleeps when the list is empty; producers touch the
+ *   mutex/condvar only if it announced it is idle (eventcount pattern).
+ *
+ * Sync messages live on the caller's stack (the caller waits for completion),
+ * async messages are heap-allocated and freed by the VM thread.
+ */
 
 typedef enum {
     HLFFI_MSG_NONE,
@@ -60,59 +105,185 @@ typedef enum {
     HLFFI_MSG_STOP
 } hlffi_message_type;
 
+/*
+ * Per-caller completion: each sync call waits on its own primitive, so the
+ * VM thread wakes exactly the caller whose work finished (no shared condvar,
+ * no global mutex). `remaining` counts the caller's outstanding messages.
+ */
 typedef struct {
+    int remaining;          /* Messages not yet completed (atomic) */
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} hlffi_thread_completion;
+
+typedef struct hlffi_thread_message {
+    struct hlffi_thread_message* next;
     hlffi_message_type type;
     hlffi_thread_func func;
+    hlffi_thread_result_func result_func;  /* Used instead of func if set */
     void* userdata;
     hlffi_thread_async_callback async_callback;
     void* result;
-    bool* completion_flag;  /* Pointer to caller's completion flag (for sync calls) */
+    hlffi_thread_completion* completion;   /* Caller's completion (sync calls) */
+    bool heap_allocated;    /* Freed by the VM thread after processing */
+    bool cancelled;         /* Thread stopped before the message ran */
 } hlffi_thread_message;
 
 typedef struct {
-    hlffi_thread_message messages[HLFFI_MSG_QUEUE_SIZE];
-    int head;  /* Read position */
-    int tail;  /* Write position */
-    int count; /* Number of messages */
+    hlffi_thread_message* head;  /* Producer side: newest first (atomic) */
+    int pending;                 /* Messages pushed but not yet processed (atomic) */
+    int consumer_idle;           /* VM thread is (about to be) waiting (atomic) */
 } hlffi_thread_message_queue;
 
-/* ========== QUEUE OPERATIONS (NOT THREAD-SAFE, MUST HOLD MUTEX) ========== */
+/* ========== QUEUE OPERATIONS (LOCK-FREE) ========== */
 
 static hlffi_thread_message_queue* queue_create(void) {
     hlffi_thread_message_queue* q = (hlffi_thread_message_queue*)calloc(1, sizeof(hlffi_thread_message_queue));
     return q;
 }
 
-static void queue_destroy(hlffi_thread_message_queue* q) {
+static void queue_complete(hlffi_vm* vm, hlffi_thread_message* msg);
+
+static void queue_destroy(hlffi_vm* vm, hlffi_thread_message_queue* q) {
+    if (!q) return;
+
+    /* Release messages that were never processed (posted while stopping);
+     * sync callers see `cancelled` and report an error instead of success */
+    hlffi_thread_message* msg = (hlffi_thread_message*)atomic_xchg_ptr(&q->head, NULL);
+    while (msg) {
+        hlffi_thread_message* next = msg->next;
+        msg->cancelled = true;
+        queue_complete(vm, msg);
+        msg = next;
+    }
+
     free(q);
 }
 
 static bool queue_is_empty(hlffi_thread_message_queue* q) {
-    return q->count == 0;
+    return atomic_load_ptr(&q->head) == NULL;
 }
 
-static bool queue_is_full(hlffi_thread_message_queue* q) {
-    return q->count >= HLFFI_MSG_QUEUE_SIZE;
+/* Push a message (any thread). Wakes the VM thread only if it is idle. */
+static void queue_push(hlffi_vm* vm, hlffi_thread_message_queue* q, hlffi_thread_message* msg) {
+    atomic_add_int(&q->pending, 1);
+
+    hlffi_thread_message* head;
+    do {
+        head = (hlffi_thread_message*)atomic_load_ptr(&q->head);
+        msg->next = head;
+    } while (!atomic_cas_ptr(&q->head, head, msg));
+
+    if (atomic_load_int(&q->consumer_idle)) {
+        pthread_mutex_t* mutex = (pthread_mutex_t*)vm->thread_mutex;
+        pthread_mutex_lock(mutex);
+        pthread_cond_signal((pthread_cond_t*)vm->thread_cond_var);
+        pthread_mutex_unlock(mutex);
+    }
 }
 
-static bool queue_enqueue(hlffi_thread_message_queue* q, hlffi_thread_message* msg) {
-    if (queue_is_full(q)) {
-        return false;
+/* Take all pending messages in FIFO order (VM thread only) */
+static hlffi_thread_message* queue_take_all(hlffi_thread_message_queue* q) {
+    hlffi_thread_message* lifo = (hlffi_thread_message*)atomic_xchg_ptr(&q->head, NULL);
+
+    hlffi_thread_message* fifo = NULL;
+    while (lifo) {
+        hlffi_thread_message* next = lifo->next;
+        lifo->next = fifo;
+        fifo = lifo;
+        lifo = next;
     }
-    q->messages[q->tail] = *msg;
-    q->tail = (q->tail + 1) % HLFFI_MSG_QUEUE_SIZE;
-    q->count++;
-    return true;
+    return fifo;
 }
 
-static bool queue_dequeue(hlffi_thread_message_queue* q, hlffi_thread_message* msg) {
-    if (queue_is_empty(q)) {
-        return false;
+/* Block until messages are pending or stop is requested (VM thread only).
+ * timeout_ms >= 0 returns after at most one timed wait. */
+static void queue_wait(hlffi_vm* vm, hlffi_thread_message_queue* q, int timeout_ms) {
+    pthread_mutex_t* mutex = (pthread_mutex_t*)vm->thread_mutex;
+    pthread_cond_t* cond_var = (pthread_cond_t*)vm->thread_cond_var;
+
+    pthread_mutex_lock(mutex);
+    atomic_store_int(&q->consumer_idle, 1);
+
+    /* Re-check after announcing idle: a producer that pushed before seeing
+     * the flag is visible here, one that pushes after will signal */
+    while (queue_is_empty(q) && !vm->thread_should_stop) {
+        if (timeout_ms >= 0) {
+            cond_wait_ms(cond_var, mutex, timeout_ms);
+            break;
+        }
+        /* An async reload was published while idle: go poll for it */
+        if (hlffi_reload_pending(vm)) {
+            break;
+        }
+        pthread_cond_wait(cond_var, mutex);
+    }
+
+    atomic_store_int(&q->consumer_idle, 0);
+    pthread_mutex_unlock(mutex);
+}
+
+/* ========== COMPLETIONS ========== */
+
+/* Spins before blocking: most sync calls are short script calls */
+#define HLFFI_COMPLETION_SPIN 2000
+
+static void completion_init(hlffi_thread_completion* c, int count) {
+    c->remaining = count;
+    pthread_mutex_init(&c->mutex, NULL);
+    pthread_cond_init(&c->cond, NULL);
+}
+
+/* Mark one message done (VM thread); the last one wakes the caller */
+static void completion_signal(hlffi_thread_completion* c) {
+    pthread_mutex_lock(&c->mutex);
+    if (atomic_add_int(&c->remaining, -1) == 1) {
+        pthread_cond_signal(&c->cond);
+    }
+    pthread_mutex_unlock(&c->mutex);
+}
+
+/* Wait for all messages (caller thread), then release the primitive */
+static void completion_wait(hlffi_thread_completion* c) {
+    for (int i = 0; i < HLFFI_COMPLETION_SPIN && atomic_load_int(&c->remaining) > 0; i++) {
+        /* busy wait */
+    }
+
+    /* Lock even if already done: the VM thread may still be inside
+     * completion_signal() and must unlock before the mutex is destroyed */
+    pthread_mutex_lock(&c->mutex);
+    while (atomic_load_int(&c->remaining) > 0) {
+        pthread_cond_wait(&c->cond, &c->mutex);
+    }
+    pthread_mutex_unlock(&c->mutex);
+
+    pthread_mutex_destroy(&c->mutex);
+    pthread_cond_destroy(&c->cond);
+}
+
+/* Finish a message: signal its sync caller or free an async message */
+static void queue_complete(hlffi_vm* vm, hlffi_thread_message* msg) {
+    hlffi_thread_message_queue* q = (hlffi_thread_message_queue*)vm->message_queue;
+    if (q) {
+        atomic_add_int(&q->pending, -1);
+    }
+
+    if (msg->completion) {
+        completion_signal(msg->completion);
+    } else if (msg->heap_allocated) {
+        free(msg);
     }
-    *msg = q->messages[q->head];
-    q->head = (q->head + 1) % HLFFI_MSG_QUEUE_SIZE;
-    q->count--;
-    return true;
+}
+
+/* Run a message's function on the VM thread, returning its result */
+static void* run_message(hlffi_vm* vm, hlffi_thread_message* msg) {
+    if (msg->result_func) {
+        return msg->result_func(vm, msg->userdata);
+    }
+    if (msg->func) {
+        msg->func(vm, msg->userdata);
+    }
+    return NULL;
 }
 
 /* ========== THREAD MAIN LOOP ========== */
@@ -124,9 +295,6 @@ static void* vm_thread_main(void* param)
 #endif
 {
     hlffi_vm* vm = (hlffi_vm*)param;
-    pthread_mutex_t* mutex = (pthread_mutex_t*)vm->thread_mutex;
-    pthread_cond_t* cond_var = (pthread_cond_t*)vm->thread_cond_var;
-    pthread_cond_t* response_cond = (pthread_cond_t*)vm->thread_response_cond;
     hlffi_thread_message_queue* queue = (hlffi_thread_message_queue*)vm->message_queue;
 
     /* CRITICAL: Register this thread with HashLink GC before any HL calls */
@@ -137,53 +305,43 @@ static void* vm_thread_main(void* param)
     hlffi_call_entry(vm);
 
     /* Process messages until stop requested */
+    bool stopping = false;
     while (1) {
-        hlffi_thread_message msg;
-        bool has_message = false;
-
-        /* Wait for message */
-        pthread_mutex_lock(mutex);
-        while (queue_is_empty(queue) && !vm->thread_should_stop) {
-            pthread_cond_wait(cond_var, mutex);
-        }
+        /* Safe point between batches: apply a hot reload parsed off-thread */
+        hlffi_reload_apply_pending(vm);
 
-        if (vm->thread_should_stop && queue_is_empty(queue)) {
-            pthread_mutex_unlock(mutex);
-            break;
-        }
-
-        if (queue_dequeue(queue, &msg)) {
-            has_message = true;
+        /* Take every pending message as one batch */
+        hlffi_thread_message* batch = queue_take_all(queue);
+        if (!batch) {
+            if (stopping) {
+                break;
+            }
+            /* The reload worker never signals us: poll while one is parsing
+             * (the host wakes us when it publishes the job) */
+            queue_wait(vm, queue, hlffi_reload_pending(vm) ? HLFFI_RELOAD_APPLY_POLL_MS : -1);
+            continue;
         }
-        pthread_mutex_unlock(mutex);
 
-        /* Process message */
-        if (has_message) {
-            if (msg.type == HLFFI_MSG_STOP) {
-                break;
-            } else if (msg.type == HLFFI_MSG_CALL_SYNC) {
+        while (batch) {
+            hlffi_thread_message* msg = batch;
+            batch = msg->next;
+
+            if (msg->type == HLFFI_MSG_STOP) {
+                /* Finish what was queued before exiting */
+                stopping = true;
+            } else if (msg->type == HLFFI_MSG_CALL_SYNC) {
+                /* Execute function; the caller reads msg->result after completion */
+                msg->result = run_message(vm, msg);
+            } else if (msg->type == HLFFI_MSG_CALL_ASYNC) {
                 /* Execute function */
-                if (msg.func) {
-                    msg.func(vm, msg.userdata);
-                }
-                /* Signal completion via caller's flag pointer */
-                pthread_mutex_lock(mutex);
-                if (msg.completion_flag) {
-                    *msg.completion_flag = true;
-                }
-                pthread_cond_signal(response_cond);
-                pthread_mutex_unlock(mutex);
-            } else if (msg.type == HLFFI_MSG_CALL_ASYNC) {
-                /* Execute function */
-                void* result = NULL;
-                if (msg.func) {
-                    msg.func(vm, msg.userdata);
-                }
+                void* result = run_message(vm, msg);
                 /* Call async callback (on VM thread) */
-                if (msg.async_callback) {
-                    msg.async_callback(vm, result, msg.userdata);
+                if (msg->async_callback) {
+                    msg->async_callback(vm, result, msg->userdata);
                 }
             }
+
+            queue_complete(vm, msg);
         }
     }
 
@@ -225,18 +383,16 @@ hlffi_error_code hlffi_thread_start(hlffi_vm* vm) {
     /* Allocate threading resources */
     vm->thread_mutex = malloc(sizeof(pthread_mutex_t));
     vm->thread_cond_var = malloc(sizeof(pthread_cond_t));
-    vm->thread_response_cond = malloc(sizeof(pthread_cond_t));
     vm->message_queue = queue_create();
     vm->thread_handle = malloc(sizeof(pthread_t));
 
-    if (!vm->thread_mutex || !vm->thread_cond_var || !vm->thread_response_cond ||
+    if (!vm->thread_mutex || !vm->thread_cond_var ||
         !vm->message_queue || !vm->thread_handle) {
         snprintf(vm->error_msg, sizeof(vm->error_msg), "Failed to allocate threading resources");
         /* Cleanup partial allocation */
         free(vm->thread_mutex);
         free(vm->thread_cond_var);
-        free(vm->thread_response_cond);
-        queue_destroy((hlffi_thread_message_queue*)vm->message_queue);
+        queue_destroy(vm, (hlffi_thread_message_queue*)vm->message_queue);
         free(vm->thread_handle);
         return HLFFI_ERROR_OUT_OF_MEMORY;
     }
@@ -244,7 +400,6 @@ hlffi_error_code hlffi_thread_start(hlffi_vm* vm) {
     /* Initialize synchronization primitives */
     pthread_mutex_init((pthread_mutex_t*)vm->thread_mutex, NULL);
     pthread_cond_init((pthread_cond_t*)vm->thread_cond_var, NULL);
-    pthread_cond_init((pthread_cond_t*)vm->thread_response_cond, NULL);
 
     /* Start thread */
     vm->thread_should_stop = false;
@@ -260,15 +415,12 @@ hlffi_error_code hlffi_thread_start(hlffi_vm* vm) {
         vm->thread_running = false;
         pthread_mutex_destroy((pthread_mutex_t*)vm->thread_mutex);
         pthread_cond_destroy((pthread_cond_t*)vm->thread_cond_var);
-        pthread_cond_destroy((pthread_cond_t*)vm->thread_response_cond);
-        queue_destroy((hlffi_thread_message_queue*)vm->message_queue);
+        queue_destroy(vm, (hlffi_thread_message_queue*)vm->message_queue);
         free(vm->thread_mutex);
         free(vm->thread_cond_var);
-        free(vm->thread_response_cond);
         free(vm->thread_handle);
         vm->thread_mutex = NULL;
         vm->thread_cond_var = NULL;
-        vm->thread_response_cond = NULL;
         vm->message_queue = NULL;
         vm->thread_handle = NULL;
         return HLFFI_ERROR_OUT_OF_MEMORY;
@@ -277,6 +429,18 @@ hlffi_error_code hlffi_thread_start(hlffi_vm* vm) {
     return HLFFI_OK;
 }
 
+void hlffi_thread_wake(hlffi_vm* vm) {
+    if (!vm->thread_running) {
+        return;
+    }
+
+    /* Under the mutex: queue_wait checks its predicate while holding it */
+    pthread_mutex_t* mutex = (pthread_mutex_t*)vm->thread_mutex;
+    pthread_mutex_lock(mutex);
+    pthread_cond_signal((pthread_cond_t*)vm->thread_cond_var);
+    pthread_mutex_unlock(mutex);
+}
+
 hlffi_error_code hlffi_thread_stop(hlffi_vm* vm) {
     if (!vm) {
         return HLFFI_ERROR_INVALID_ARGUMENT;
@@ -290,13 +454,12 @@ hlffi_error_code hlffi_thread_stop(hlffi_vm* vm) {
     pthread_cond_t* cond_var = (pthread_cond_t*)vm->thread_cond_var;
     hlffi_thread_message_queue* queue = (hlffi_thread_message_queue*)vm->message_queue;
 
-    /* Send stop message */
+    /* Send stop message (on our stack: we join the VM thread below) */
+    hlffi_thread_message stop_msg = { .type = HLFFI_MSG_STOP };
     pthread_mutex_lock(mutex);
     vm->thread_should_stop = true;
-    hlffi_thread_message msg = { .type = HLFFI_MSG_STOP };
-    queue_enqueue(queue, &msg);
-    pthread_cond_signal(cond_var);
     pthread_mutex_unlock(mutex);
+    queue_push(vm, queue, &stop_msg);
 
     /* Wait for thread to exit */
 #ifdef _WIN32
@@ -306,18 +469,16 @@ hlffi_error_code hlffi_thread_stop(hlffi_vm* vm) {
     pthread_join(*(pthread_t*)vm->thread_handle, NULL);
 #endif
 
-    /* Cleanup resources */
+    /* Cleanup resources (queue first: it may complete late sync callers) */
+    queue_destroy(vm, queue);
+    vm->message_queue = NULL;
     pthread_mutex_destroy(mutex);
     pthread_cond_destroy(cond_var);
-    pthread_cond_destroy((pthread_cond_t*)vm->thread_response_cond);
-    queue_destroy(queue);
     free(vm->thread_mutex);
     free(vm->thread_cond_var);
-    free(vm->thread_response_cond);
     free(vm->thread_handle);
     vm->thread_mutex = NULL;
     vm->thread_cond_var = NULL;
-    vm->thread_response_cond = NULL;
     vm->message_queue = NULL;
     vm->thread_handle = NULL;
     vm->thread_running = false;
@@ -332,93 +493,205 @@ bool hlffi_thread_is_running(hlffi_vm* vm) {
     return vm->thread_running;
 }
 
-hlffi_error_code hlffi_thread_call_sync(hlffi_vm* vm, hlffi_thread_func func, void* userdata) {
-    if (!vm || !func) {
-        return HLFFI_ERROR_INVALID_ARGUMENT;
-    }
-
+/* Queue a message and block until the VM thread has processed it */
+static hlffi_error_code submit_sync(hlffi_vm* vm, hlffi_thread_message* msg) {
     if (!vm->thread_running) {
         snprintf(vm->error_msg, sizeof(vm->error_msg), "Thread not running");
         return HLFFI_ERROR_THREAD_NOT_STARTED;
     }
 
-    pthread_mutex_t* mutex = (pthread_mutex_t*)vm->thread_mutex;
-    pthread_cond_t* cond_var = (pthread_cond_t*)vm->thread_cond_var;
-    pthread_cond_t* response_cond = (pthread_cond_t*)vm->thread_response_cond;
-    hlffi_thread_message_queue* queue = (hlffi_thread_message_queue*)vm->message_queue;
+    /* Message and completion live on our stack: we block until the VM
+     * thread is done with both */
+    hlffi_thread_completion completion;
+    completion_init(&completion, 1);
+    msg->type = HLFFI_MSG_CALL_SYNC;
+    msg->completion = &completion;
 
-    /* Local completion flag - VM thread will set this via pointer */
-    bool completed = false;
+    queue_push(vm, (hlffi_thread_message_queue*)vm->message_queue, msg);
+    completion_wait(&completion);
+
+    if (msg->cancelled) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg), "Thread stopped before the call ran");
+        return HLFFI_ERROR_THREAD_NOT_STARTED;
+    }
+    return HLFFI_OK;
+}
+
+hlffi_error_code hlffi_thread_call_sync(hlffi_vm* vm, hlffi_thread_func func, void* userdata) {
+    if (!vm || !func) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
 
-    /* Enqueue message with pointer to our local completion flag */
     hlffi_thread_message msg = {
-        .type = HLFFI_MSG_CALL_SYNC,
         .func = func,
-        .userdata = userdata,
-        .completion_flag = &completed
+        .userdata = userdata
     };
+    return submit_sync(vm, &msg);
+}
 
-    pthread_mutex_lock(mutex);
+hlffi_error_code hlffi_thread_call_sync_result(
+    hlffi_vm* vm,
+    hlffi_thread_result_func func,
+    void* userdata,
+    void** result
+) {
+    if (!vm || !func) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
 
-    if (queue_is_full(queue)) {
-        pthread_mutex_unlock(mutex);
-        snprintf(vm->error_msg, sizeof(vm->error_msg), "Message queue full");
-        return HLFFI_ERROR_OUT_OF_MEMORY;
+    hlffi_thread_message msg = {
+        .result_func = func,
+        .userdata = userdata
+    };
+    hlffi_error_code err = submit_sync(vm, &msg);
+
+    if (result) {
+        *result = (err == HLFFI_OK) ? msg.result : NULL;
     }
+    return err;
+}
+
+/* ========== BATCHED SUBMISSION ========== */
 
-    queue_enqueue(queue, &msg);
-    pthread_cond_signal(cond_var);
+/*
+ * A batch travels as a single sync message whose function runs every entry
+ * on the VM thread: one enqueue, one wakeup, one completion for N calls.
+ */
+
+typedef struct {
+    void* entries;
+    int count;
+} hlffi_thread_batch;
 
-    /* Wait for completion - VM thread sets our local flag via pointer */
-    while (!completed) {
-        pthread_cond_wait(response_cond, mutex);
+static void* run_call_batch(hlffi_vm* vm, void* userdata) {
+    hlffi_thread_batch* batch = (hlffi_thread_batch*)userdata;
+    hlffi_thread_call* calls = (hlffi_thread_call*)batch->entries;
+
+    for (int i = 0; i < batch->count; i++) {
+        calls[i].result = calls[i].func ? calls[i].func(vm, calls[i].userdata) : NULL;
     }
+    return NULL;
+}
 
-    pthread_mutex_unlock(mutex);
+static void* run_cached_batch(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    hlffi_thread_batch* batch = (hlffi_thread_batch*)userdata;
+    hlffi_thread_cached_call* calls = (hlffi_thread_cached_call*)batch->entries;
+
+    for (int i = 0; i < batch->count; i++) {
+        hlffi_thread_cached_call* c = &calls[i];
+        if (c->instance) {
+            c->ok = hlffi_call_cached_method_typed(c->cached, c->instance, c->args, &c->ret);
+        } else {
+            c->ok = hlffi_call_cached_typed(c->cached, c->args, &c->ret);
+        }
+    }
+    return NULL;
+}
 
-    return HLFFI_OK;
+hlffi_error_code hlffi_thread_call_batch(hlffi_vm* vm, hlffi_thread_call* calls, int count) {
+    if (!vm || count < 0 || (count > 0 && !calls)) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
+    if (count == 0) {
+        return HLFFI_OK;
+    }
+
+    hlffi_thread_batch batch = { calls, count };
+    hlffi_thread_message msg = {
+        .result_func = run_call_batch,
+        .userdata = &batch
+    };
+    return submit_sync(vm, &msg);
 }
 
-hlffi_error_code hlffi_thread_call_async(
+hlffi_error_code hlffi_thread_call_cached_batch(hlffi_vm* vm, hlffi_thread_cached_call* calls, int count) {
+    if (!vm || count < 0 || (count > 0 && !calls)) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
+    if (count == 0) {
+        return HLFFI_OK;
+    }
+
+    hlffi_thread_batch batch = { calls, count };
+    hlffi_thread_message msg = {
+        .result_func = run_cached_batch,
+        .userdata = &batch
+    };
+    return submit_sync(vm, &msg);
+}
+
+/* Queue a heap message without waiting (VM thread frees it) */
+static hlffi_error_code submit_async(
     hlffi_vm* vm,
     hlffi_thread_func func,
+    hlffi_thread_result_func result_func,
     hlffi_thread_async_callback callback,
     void* userdata
 ) {
-    if (!vm || !func) {
-        return HLFFI_ERROR_INVALID_ARGUMENT;
-    }
-
     if (!vm->thread_running) {
         snprintf(vm->error_msg, sizeof(vm->error_msg), "Thread not running");
         return HLFFI_ERROR_THREAD_NOT_STARTED;
     }
 
-    pthread_mutex_t* mutex = (pthread_mutex_t*)vm->thread_mutex;
-    pthread_cond_t* cond_var = (pthread_cond_t*)vm->thread_cond_var;
     hlffi_thread_message_queue* queue = (hlffi_thread_message_queue*)vm->message_queue;
 
-    /* Enqueue message (no completion flag for async - fire and forget) */
-    hlffi_thread_message msg = {
-        .type = HLFFI_MSG_CALL_ASYNC,
-        .func = func,
-        .userdata = userdata,
-        .async_callback = callback,
-        .completion_flag = NULL
-    };
-
-    pthread_mutex_lock(mutex);
+    /* Optional backpressure (hlffi_thread_set_queue_limit) */
+    int limit = vm->thread_queue_limit;
+    if (limit > 0 && atomic_load_int(&queue->pending) >= limit) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg), "Message queue full (limit %d)", limit);
+        return HLFFI_ERROR_QUEUE_FULL;
+    }
 
-    if (queue_is_full(queue)) {
-        pthread_mutex_unlock(mutex);
-        snprintf(vm->error_msg, sizeof(vm->error_msg), "Message queue full");
+    /* Heap message (no completion for async - fire and forget) */
+    hlffi_thread_message* msg = (hlffi_thread_message*)calloc(1, sizeof(hlffi_thread_message));
+    if (!msg) {
+        snprintf(vm->error_msg, sizeof(vm->error_msg), "Failed to allocate message");
         return HLFFI_ERROR_OUT_OF_MEMORY;
     }
 
-    queue_enqueue(queue, &msg);
-    pthread_cond_signal(cond_var);
-    pthread_mutex_unlock(mutex);
+    msg->type = HLFFI_MSG_CALL_ASYNC;
+    msg->func = func;
+    msg->result_func = result_func;
+    msg->userdata = userdata;
+    msg->async_callback = callback;
+    msg->heap_allocated = true;
+
+    queue_push(vm, queue, msg);
+
+    return HLFFI_OK;
+}
+
+hlffi_error_code hlffi_thread_call_async(
+    hlffi_vm* vm,
+    hlffi_thread_func func,
+    hlffi_thread_async_callback callback,
+    void* userdata
+) {
+    if (!vm || !func) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
+    return submit_async(vm, func, NULL, callback, userdata);
+}
+
+hlffi_error_code hlffi_thread_call_async_result(
+    hlffi_vm* vm,
+    hlffi_thread_result_func func,
+    hlffi_thread_async_callback callback,
+    void* userdata
+) {
+    if (!vm || !func) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
+    return submit_async(vm, NULL, func, callback, userdata);
+}
+
+hlffi_error_code hlffi_thread_set_queue_limit(hlffi_vm* vm, int max_pending) {
+    if (!vm || max_pending < 0) {
+        return HLFFI_ERROR_INVALID_ARGUMENT;
+    }
 
+    vm->thread_queue_limit = max_pending;
     return HLFFI_OK;
 }
 
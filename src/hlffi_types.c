@@ -16,6 +16,125 @@
 extern hl_type* hlffi_hlc_find_type(hlffi_vm* vm, const char* name);
 #endif
 
+/* ========== TYPE NAME INDEX ========== */
+
+/*
+ * Every by-name lookup (hlffi_find_type, hlffi_new, hlffi_call_static,
+ * hlffi_cache_static_method, ...) used to walk all of code->types and convert
+ * each name to UTF-8. Modules with thousands of types made that cost tens of
+ * microseconds per call, so the names are hashed once at load time into an
+ * open-addressing table (linear probing, power-of-two capacity, load <= 0.5).
+ */
+
+/* Name of a named type (HOBJ/HENUM/HABSTRACT), NULL for anything else */
+static const uchar* type_index_name(hl_type* t) {
+    switch (t->kind) {
+        case HOBJ:      return t->obj ? t->obj->name : NULL;
+        case HENUM:     return t->tenum ? t->tenum->name : NULL;
+        case HABSTRACT: return t->abs_name;
+        default:        return NULL;
+    }
+}
+
+static void type_index_insert(hlffi_vm* vm, int hash, const char* name, hl_type* t) {
+    int mask = vm->type_index_capacity - 1;
+    int slot = hash & mask;
+
+    while (vm->type_index[slot].name) {
+        hlffi_type_index_entry* e = &vm->type_index[slot];
+        if (e->hash == hash && strcmp(e->name, name) == 0) {
+            return;  /* Keep first occurrence (matches former linear scan) */
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    char* copy = (char*)malloc(strlen(name) + 1);
+    if (!copy) return;
+    strcpy(copy, name);
+
+    vm->type_index[slot].hash = hash;
+    vm->type_index[slot].name = copy;
+    vm->type_index[slot].type = t;
+    vm->type_index_count++;
+}
+
+void hlffi_type_index_free(hlffi_vm* vm) {
+    if (!vm) return;
+
+    /* Layouts remembered for the old types */
+    vm->map_type_count = 0;
+    vm->map_type_next = 0;
+
+    if (!vm->type_index) return;
+
+    for (int i = 0; i < vm->type_index_capacity; i++) {
+        free(vm->type_index[i].name);
+    }
+    free(vm->type_index);
+
+    vm->type_index = NULL;
+    vm->type_index_capacity = 0;
+    vm->type_index_count = 0;
+    vm->string_type = NULL;
+}
+
+void hlffi_type_index_build(hlffi_vm* vm) {
+    if (!vm) return;
+
+    hlffi_type_index_free(vm);
+
+#ifdef HLFFI_HLC_MODE
+    /* HLC: types are resolved through Type.resolveClass(), nothing to index */
+    return;
+#else
+    if (!vm->module || !vm->module->code) return;
+
+    HLFFI_UPDATE_STACK_TOP();  /* hl_to_utf8 allocates from the GC */
+
+    hl_code* code = vm->module->code;
+
+    /* Capacity: next power of two >= 2 * ntypes */
+    int capacity = 16;
+    while (capacity < code->ntypes * 2) capacity <<= 1;
+
+    vm->type_index = (hlffi_type_index_entry*)calloc(capacity, sizeof(hlffi_type_index_entry));
+    if (!vm->type_index) return;  /* Lookups will report "not found" */
+    vm->type_index_capacity = capacity;
+
+    for (int i = 0; i < code->ntypes; i++) {
+        hl_type* t = code->types + i;
+        const uchar* uname = type_index_name(t);
+        if (!uname) continue;
+
+        char* name = hl_to_utf8(uname);
+        if (!name) continue;
+
+        type_index_insert(vm, hl_hash_utf8(name), name, t);
+    }
+
+    /* Used to tag interned strings and to recognize String parameters */
+    vm->string_type = hlffi_type_index_lookup_class(vm, "String");
+#endif /* HLFFI_HLC_MODE */
+}
+
+hl_type* hlffi_type_index_lookup(hlffi_vm* vm, const char* name) {
+    if (!vm || !name || !vm->type_index) return NULL;
+
+    int hash = hl_hash_utf8(name);
+    int mask = vm->type_index_capacity - 1;
+    int slot = hash & mask;
+
+    while (vm->type_index[slot].name) {
+        hlffi_type_index_entry* e = &vm->type_index[slot];
+        if (e->hash == hash && strcmp(e->name, name) == 0) {
+            return e->type;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return NULL;
+}
+
 /* ========== TYPE LOOKUP ========== */
 
 hlffi_type* hlffi_find_type(hlffi_vm* vm, const char* name) {
@@ -30,55 +149,16 @@ hlffi_type* hlffi_find_type(hlffi_vm* vm, const char* name) {
     return (hlffi_type*)hlffi_hlc_find_type(vm, name);
 
 #else
-    /*=== JIT Mode: Scan code->types[] ===*/
+    /*=== JIT Mode: Type name index built at load time ===*/
 
     if (!vm->module || !vm->module->code) {
         set_error(vm, HLFFI_ERROR_NOT_INITIALIZED, "VM not initialized or no bytecode loaded");
         return NULL;
     }
 
-    hl_code* code = vm->module->code;
-
-    /* Hash the search name once */
-    int target_hash = hl_hash_utf8(name);
-
-    /* Search all types in loaded module */
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type *t = code->types + i;
-
-        /* For object types, compare names */
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            /* Convert UTF-16 name to UTF-8 */
-            char* type_name_utf8 = hl_to_utf8(t->obj->name);
-            if (type_name_utf8) {
-                /* Hash and compare */
-                int type_hash = hl_hash_utf8(type_name_utf8);
-                if (type_hash == target_hash) {
-                    /* Found it! */
-                    return (hlffi_type*)t;
-                }
-            }
-        }
-        /* For enum types */
-        else if (t->kind == HENUM && t->tenum && t->tenum->name) {
-            char* type_name_utf8 = hl_to_utf8(t->tenum->name);
-            if (type_name_utf8) {
-                int type_hash = hl_hash_utf8(type_name_utf8);
-                if (type_hash == target_hash) {
-                    return (hlffi_type*)t;
-                }
-            }
-        }
-        /* For abstract types */
-        else if (t->kind == HABSTRACT && t->abs_name) {
-            char* type_name_utf8 = hl_to_utf8(t->abs_name);
-            if (type_name_utf8) {
-                int type_hash = hl_hash_utf8(type_name_utf8);
-                if (type_hash == target_hash) {
-                    return (hlffi_type*)t;
-                }
-            }
-        }
+    hl_type* t = hlffi_type_index_lookup(vm, name);
+    if (t) {
+        return (hlffi_type*)t;
     }
 
     /* Type not found */
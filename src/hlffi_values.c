@@ -27,7 +27,7 @@ hlffi_value* hlffi_value_int(hlffi_vm* vm, int value) {
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
 
     /* Box the integer */
@@ -43,7 +43,7 @@ hlffi_value* hlffi_value_float(hlffi_vm* vm, double value) {
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
 
     /* Box the float */
@@ -59,7 +59,7 @@ hlffi_value* hlffi_value_f32(hlffi_vm* vm, float value) {
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
 
     /* Box the f32 */
@@ -75,7 +75,7 @@ hlffi_value* hlffi_value_bool(hlffi_vm* vm, bool value) {
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
 
     /* Box the boolean */
@@ -86,15 +86,9 @@ hlffi_value* hlffi_value_bool(hlffi_vm* vm, bool value) {
     return wrapped;
 }
 
-hlffi_value* hlffi_value_string(hlffi_vm* vm, const char* str) {
-    if (!vm) return NULL;
-    if (!str) return hlffi_value_null(vm);
-
-    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
-
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
-    if (!wrapped) return NULL;
-
+/* Create a HashLink string from UTF-8 (HBYTES-tagged vstring, retagged to
+ * String at call sites that expect one) */
+static vdynamic* alloc_string(const char* str) {
     /* Create HashLink string using the dexutils.h pattern:
      * 1. Allocate UTF-16 buffer with hl_gc_alloc_noptr()
      * 2. Convert UTF-8 to UTF-16 using hl_from_utf8()
@@ -103,24 +97,34 @@ hlffi_value* hlffi_value_string(hlffi_vm* vm, const char* str) {
      */
     int str_len = (int)strlen(str);
     uchar* ubuf = (uchar*)hl_gc_alloc_noptr((str_len + 1) << 1);  // UTF-16 needs 2 bytes per char
-    if (!ubuf) {
-        free(wrapped);
-        return NULL;
-    }
+    if (!ubuf) return NULL;
 
     hl_from_utf8(ubuf, str_len, str);  // Convert UTF-8 → UTF-16
 
     vstring* vstr = (vstring*)hl_gc_alloc_raw(sizeof(vstring));
-    if (!vstr) {
-        free(wrapped);
-        return NULL;
-    }
+    if (!vstr) return NULL;
 
     vstr->bytes = ubuf;
     vstr->length = str_len;
     vstr->t = &hlt_bytes;
 
-    wrapped->hl_value = (vdynamic*)vstr;
+    return (vdynamic*)vstr;
+}
+
+hlffi_value* hlffi_value_string(hlffi_vm* vm, const char* str) {
+    if (!vm) return NULL;
+    if (!str) return hlffi_value_null(vm);
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
+    if (!wrapped) return NULL;
+
+    wrapped->hl_value = alloc_string(str);
+    if (!wrapped->hl_value) {
+        hlffi_value_free(wrapped);
+        return NULL;
+    }
     wrapped->is_rooted = false;
 
     return wrapped;
@@ -129,7 +133,7 @@ hlffi_value* hlffi_value_string(hlffi_vm* vm, const char* str) {
 hlffi_value* hlffi_value_null(hlffi_vm* vm) {
     if (!vm) return NULL;
 
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
 
     wrapped->hl_value = NULL;
@@ -141,6 +145,9 @@ hlffi_value* hlffi_value_null(hlffi_vm* vm) {
 void hlffi_value_free(hlffi_value* value) {
     if (!value) return;
 
+    /* Scope slots are released together by hlffi_scope_end */
+    if (value->in_scope) return;
+
     /* Remove GC root if we added one */
     if (value->is_rooted && value->hl_value) {
         hl_remove_root(&value->hl_value);
@@ -259,6 +266,492 @@ bool hlffi_value_is_null(hlffi_value* value) {
     return !value || !value->hl_value;
 }
 
+/* ========== CALLER-STORAGE VALUES ========== */
+
+/*
+ * Same boxing as the constructors above, but the wrapper lives in storage
+ * owned by the caller (stack, arrays, structs) - no malloc, no free.
+ * hlffi_value_storage is the public, opaque-sized view of struct hlffi_value.
+ */
+
+hlffi_value* hlffi_value_init(hlffi_value_storage* storage) {
+    if (!storage) return NULL;
+
+    hlffi_value* value = (hlffi_value*)storage;
+    value->hl_value = NULL;
+    value->is_rooted = false;
+    value->in_scope = false;
+
+    return value;
+}
+
+hlffi_value* hlffi_value_int_at(hlffi_vm* vm, hlffi_value_storage* storage, int value) {
+    if (!vm || !storage) return NULL;
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    hlffi_value* wrapped = hlffi_value_init(storage);
+    wrapped->hl_value = hl_alloc_dynamic(&hlt_i32);
+    wrapped->hl_value->v.i = value;
+
+    return wrapped;
+}
+
+hlffi_value* hlffi_value_float_at(hlffi_vm* vm, hlffi_value_storage* storage, double value) {
+    if (!vm || !storage) return NULL;
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    hlffi_value* wrapped = hlffi_value_init(storage);
+    wrapped->hl_value = hl_alloc_dynamic(&hlt_f64);
+    wrapped->hl_value->v.d = value;
+
+    return wrapped;
+}
+
+hlffi_value* hlffi_value_bool_at(hlffi_vm* vm, hlffi_value_storage* storage, bool value) {
+    if (!vm || !storage) return NULL;
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    hlffi_value* wrapped = hlffi_value_init(storage);
+    wrapped->hl_value = hl_alloc_dynamic(&hlt_bool);
+    wrapped->hl_value->v.b = value;
+
+    return wrapped;
+}
+
+hlffi_value* hlffi_value_string_at(hlffi_vm* vm, hlffi_value_storage* storage, const char* str) {
+    if (!vm || !storage) return NULL;
+
+    hlffi_value* wrapped = hlffi_value_init(storage);
+    if (!str) return wrapped;
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    wrapped->hl_value = alloc_string(str);
+    return wrapped->hl_value ? wrapped : NULL;
+}
+
+void hlffi_value_release(hlffi_value* value) {
+    if (!value) return;
+
+    /* Remove GC root if we added one (the root is the slot address,
+     * registered even if the slot currently holds null) */
+    if (value->is_rooted) {
+        hl_remove_root(&value->hl_value);
+    }
+
+    value->hl_value = NULL;
+    value->is_rooted = false;
+}
+
+/* ========== VALUE SCOPES ========== */
+
+#if defined(_MSC_VER)
+#define HLFFI_THREAD_LOCAL __declspec(thread)
+#else
+#define HLFFI_THREAD_LOCAL _Thread_local
+#endif
+
+/* VM whose scope is innermost on this thread, for value APIs that take no VM
+ * (hlffi_call_method, hlffi_get_field, hlffi_enum_get_param) */
+static HLFFI_THREAD_LOCAL hlffi_vm* active_scope_vm = NULL;
+
+/* Address is unique per thread: identifies the thread that owns a VM's scopes */
+static HLFFI_THREAD_LOCAL char scope_thread_tag;
+
+static hlffi_scope_block* scope_block_alloc(void) {
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    /* Raw (conservatively scanned) memory: values stored in the slots stay
+     * reachable as long as the block is */
+    hlffi_scope_block* block = (hlffi_scope_block*)hl_gc_alloc_raw(sizeof(hlffi_scope_block));
+    if (block) memset(block, 0, sizeof(hlffi_scope_block));
+    return block;
+}
+
+/* Bump-allocate a slot, moving to (or appending) the next block when full */
+static hlffi_value* scope_alloc(hlffi_vm* vm) {
+    hlffi_scope_block* block = vm->scope_current;
+    if (block->used == HLFFI_SCOPE_BLOCK_VALUES) {
+        if (!block->next) {
+            block->next = scope_block_alloc();
+            if (!block->next) return NULL;
+        }
+        block = block->next;
+        block->used = 0;
+        vm->scope_current = block;
+    }
+
+    hlffi_value* value = &block->values[block->used++];
+    value->hl_value = NULL;
+    value->is_rooted = false;
+    value->in_scope = true;
+    return value;
+}
+
+hlffi_value* hlffi_value_alloc(hlffi_vm* vm) {
+    if (!vm) vm = active_scope_vm;
+    /* Only the thread that opened the scope uses the arena: another thread
+     * allocating for the same VM (e.g. the THREADED VM thread) mallocs */
+    if (vm && vm->scope_depth > 0 && vm->scope_owner == &scope_thread_tag) {
+        return scope_alloc(vm);
+    }
+
+    hlffi_value* value = (hlffi_value*)malloc(sizeof(hlffi_value));
+    if (!value) return NULL;
+    value->hl_value = NULL;
+    value->is_rooted = false;
+    value->in_scope = false;
+    return value;
+}
+
+bool hlffi_scope_begin(hlffi_vm* vm, hlffi_scope* scope) {
+    if (!vm) return false;
+    if (!scope) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Scope is NULL");
+        return false;
+    }
+    if (vm->scope_depth > 0 && vm->scope_owner != &scope_thread_tag) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "A value scope is open on another thread");
+        return false;
+    }
+
+    /* First scope: allocate the first block and root it, once per VM */
+    if (!vm->scope_blocks) {
+        hlffi_scope_block* first = scope_block_alloc();
+        if (!first) {
+            set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate value scope");
+            return false;
+        }
+        vm->scope_blocks = first;
+        hl_add_root(&vm->scope_blocks);
+        vm->scope_current = first;
+    }
+
+    /* Mark: position in the current block, restored by hlffi_scope_end */
+    scope->opaque[0] = vm->scope_current;
+    scope->opaque[1] = (void*)(intptr_t)vm->scope_current->used;
+    scope->opaque[2] = active_scope_vm;
+
+    vm->scope_depth++;
+    vm->scope_owner = &scope_thread_tag;
+    active_scope_vm = vm;
+    return true;
+}
+
+void hlffi_scope_end(hlffi_vm* vm, hlffi_scope* scope) {
+    if (!vm || !scope || vm->scope_depth <= 0) return;
+    if (vm->scope_owner != &scope_thread_tag) return;
+
+    hlffi_scope_block* mark = (hlffi_scope_block*)scope->opaque[0];
+    int used = (int)(intptr_t)scope->opaque[1];
+
+    /* Clear the slots handed out since the mark so the GC can reclaim what
+     * they held: one memset per block touched, no per-value free or unroot */
+    hlffi_scope_block* block = mark;
+    int start = used;
+    for (;;) {
+        if (block->used > start) {
+            memset(&block->values[start], 0, (block->used - start) * sizeof(struct hlffi_value));
+        }
+        if (block == vm->scope_current) break;
+        block->used = 0;
+        block = block->next;
+        start = 0;
+    }
+
+    mark->used = used;
+    vm->scope_current = mark;
+    vm->scope_depth--;
+    if (vm->scope_depth == 0) vm->scope_owner = NULL;
+    active_scope_vm = (hlffi_vm*)scope->opaque[2];
+}
+
+void hlffi_scope_release(hlffi_vm* vm) {
+    if (!vm || !vm->scope_blocks) return;
+
+    /* Blocks are GC memory: dropping the root lets the GC reclaim the chain */
+    hl_remove_root(&vm->scope_blocks);
+    vm->scope_blocks = NULL;
+    vm->scope_current = NULL;
+    vm->scope_depth = 0;
+    vm->scope_owner = NULL;
+    if (active_scope_vm == vm) active_scope_vm = NULL;
+}
+
+/* ========== HANDLE TABLE ========== */
+
+static inline hlffi_handle handle_make(int index, uint32_t generation) {
+    return (generation << HLFFI_HANDLE_INDEX_BITS) | (uint32_t)index;
+}
+
+/* Slot of a live handle, or -1 if null, out of range or stale */
+static int handle_slot(hlffi_vm* vm, hlffi_handle handle) {
+    int index = (int)(handle & (HLFFI_HANDLE_MAX_SLOTS - 1));
+    uint32_t generation = handle >> HLFFI_HANDLE_INDEX_BITS;
+    if (handle == HLFFI_HANDLE_NULL || index >= vm->handle_capacity) return -1;
+
+    hlffi_handle_slot* slot = &vm->handle_slots[index];
+    if (!slot->live || slot->generation != generation) return -1;
+    return index;
+}
+
+/* Double the table; new slots go onto the free list */
+static bool handle_table_grow(hlffi_vm* vm) {
+    int old_capacity = vm->handle_capacity;
+    int capacity = old_capacity ? old_capacity * 2 : 256;
+    if (capacity > HLFFI_HANDLE_MAX_SLOTS) capacity = HLFFI_HANDLE_MAX_SLOTS;
+    if (capacity <= old_capacity) return false;
+
+    hlffi_handle_slot* slots = (hlffi_handle_slot*)realloc(vm->handle_slots, capacity * sizeof(hlffi_handle_slot));
+    if (!slots) return false;
+    vm->handle_slots = slots;
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    /* Objects live in one raw GC array behind a single root: growing swaps
+     * the array, the old one is collected */
+    vdynamic** objects = (vdynamic**)hl_gc_alloc_raw(capacity * sizeof(vdynamic*));
+    if (!objects) return false;
+    memset(objects, 0, capacity * sizeof(vdynamic*));
+    if (old_capacity) {
+        memcpy(objects, vm->handle_objects, old_capacity * sizeof(vdynamic*));
+    }
+    if (!vm->handle_objects) hl_add_root(&vm->handle_objects);
+    vm->handle_objects = objects;
+
+    /* Link new slots lowest index first */
+    for (int i = capacity - 1; i >= old_capacity; i--) {
+        slots[i].generation = 1;
+        slots[i].live = false;
+        slots[i].next_free = vm->handle_free;
+        vm->handle_free = i;
+    }
+    vm->handle_capacity = capacity;
+    return true;
+}
+
+hlffi_handle hlffi_handle_acquire(hlffi_vm* vm, hlffi_value* value) {
+    if (!vm) return HLFFI_HANDLE_NULL;
+    if (!value) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Value is NULL");
+        return HLFFI_HANDLE_NULL;
+    }
+
+    if (vm->handle_free < 0 && !handle_table_grow(vm)) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Handle table is full");
+        return HLFFI_HANDLE_NULL;
+    }
+
+    int index = vm->handle_free;
+    hlffi_handle_slot* slot = &vm->handle_slots[index];
+    vm->handle_free = slot->next_free;
+
+    slot->live = true;
+    slot->next_free = -1;
+    vm->handle_objects[index] = value->hl_value;
+    vm->handle_count++;
+
+    return handle_make(index, slot->generation);
+}
+
+bool hlffi_handle_release(hlffi_vm* vm, hlffi_handle handle) {
+    if (!vm) return false;
+
+    int index = handle_slot(vm, handle);
+    if (index < 0) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Stale or invalid handle");
+        return false;
+    }
+
+    /* Drop the reference and retire this generation */
+    hlffi_handle_slot* slot = &vm->handle_slots[index];
+    vm->handle_objects[index] = NULL;
+    slot->live = false;
+    slot->generation = slot->generation == HLFFI_HANDLE_GENERATION_MASK ? 1 : slot->generation + 1;
+    slot->next_free = vm->handle_free;
+    vm->handle_free = index;
+    vm->handle_count--;
+
+    return true;
+}
+
+bool hlffi_handle_is_valid(hlffi_vm* vm, hlffi_handle handle) {
+    return vm && handle_slot(vm, handle) >= 0;
+}
+
+hlffi_value* hlffi_handle_get(hlffi_vm* vm, hlffi_handle handle) {
+    if (!vm) return NULL;
+
+    int index = handle_slot(vm, handle);
+    if (index < 0) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Stale or invalid handle");
+        return NULL;
+    }
+
+    /* Unrooted view: the table keeps the object alive */
+    return hlffi_value_wrap(vm, vm->handle_objects[index]);
+}
+
+hlffi_value* hlffi_handle_get_at(hlffi_vm* vm, hlffi_handle handle, hlffi_value_storage* storage) {
+    if (!vm || !storage) return NULL;
+
+    int index = handle_slot(vm, handle);
+    if (index < 0) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Stale or invalid handle");
+        return NULL;
+    }
+
+    hlffi_value* value = hlffi_value_init(storage);
+    value->hl_value = vm->handle_objects[index];
+    return value;
+}
+
+bool hlffi_handle_set(hlffi_vm* vm, hlffi_handle handle, hlffi_value* value) {
+    if (!vm) return false;
+
+    int index = handle_slot(vm, handle);
+    if (index < 0 || !value) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, value ? "Stale or invalid handle" : "Value is NULL");
+        return false;
+    }
+
+    vm->handle_objects[index] = value->hl_value;
+    return true;
+}
+
+int hlffi_handle_count(hlffi_vm* vm) {
+    return vm ? vm->handle_count : 0;
+}
+
+void hlffi_handles_clear(hlffi_vm* vm) {
+    if (!vm) return;
+
+    if (vm->handle_objects) {
+        hl_remove_root(&vm->handle_objects);
+        vm->handle_objects = NULL;
+    }
+    free(vm->handle_slots);
+    vm->handle_slots = NULL;
+    vm->handle_capacity = 0;
+    vm->handle_count = 0;
+    vm->handle_free = -1;
+}
+
+/* ========== STRING INTERNING ========== */
+
+#define STRING_INTERN_INITIAL_CAPACITY 64
+
+/* Rehash the existing nodes into a table of new_capacity buckets (nodes do not move) */
+static bool string_intern_grow(hlffi_vm* vm, int new_capacity) {
+    hlffi_string_intern_entry** buckets =
+        (hlffi_string_intern_entry**)calloc(new_capacity, sizeof(hlffi_string_intern_entry*));
+    if (!buckets) return false;
+
+    for (int i = 0; i < vm->string_intern_capacity; i++) {
+        hlffi_string_intern_entry* e = vm->string_intern[i];
+        while (e) {
+            hlffi_string_intern_entry* next = e->next;
+            int slot = e->hash & (new_capacity - 1);
+            e->next = buckets[slot];
+            buckets[slot] = e;
+            e = next;
+        }
+    }
+
+    free(vm->string_intern);
+    vm->string_intern = buckets;
+    vm->string_intern_capacity = new_capacity;
+    return true;
+}
+
+hlffi_value* hlffi_string_intern(hlffi_vm* vm, const char* str) {
+    if (!vm) return NULL;
+    if (!str) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "String is NULL");
+        return NULL;
+    }
+
+    int hash = hl_hash_utf8(str);
+
+    /* Hit: one hash + strcmp, no allocation */
+    if (vm->string_intern_capacity > 0) {
+        hlffi_string_intern_entry* e = vm->string_intern[hash & (vm->string_intern_capacity - 1)];
+        for (; e; e = e->next) {
+            if (e->hash == hash && strcmp(e->key, str) == 0) {
+                return &e->value;
+            }
+        }
+    }
+
+    /* Miss: keep the load factor <= 1 */
+    if (vm->string_intern_count >= vm->string_intern_capacity) {
+        int capacity = vm->string_intern_capacity > 0 ? vm->string_intern_capacity * 2
+                                                      : STRING_INTERN_INITIAL_CAPACITY;
+        if (!string_intern_grow(vm, capacity)) {
+            set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to grow string intern table");
+            return NULL;
+        }
+    }
+
+    HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
+
+    hlffi_string_intern_entry* e = (hlffi_string_intern_entry*)calloc(1, sizeof(hlffi_string_intern_entry));
+    if (e) e->key = strdup(str);
+    if (!e || !e->key) {
+        free(e);
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate interned string");
+        return NULL;
+    }
+
+    vdynamic* hl_str = alloc_string(str);
+    if (!hl_str) {
+        free(e->key);
+        free(e);
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate interned string");
+        return NULL;
+    }
+
+    /* Build a real String object once, so calls never need to retag it */
+    if (vm->string_type) {
+        hl_str->t = vm->string_type;
+    }
+
+    e->hash = hash;
+    e->value.hl_value = hl_str;
+    hl_add_root(&e->value.hl_value);
+    e->value.is_rooted = true;
+
+    int slot = hash & (vm->string_intern_capacity - 1);
+    e->next = vm->string_intern[slot];
+    vm->string_intern[slot] = e;
+    vm->string_intern_count++;
+
+    return &e->value;
+}
+
+void hlffi_string_intern_clear(hlffi_vm* vm) {
+    if (!vm || !vm->string_intern) return;
+
+    for (int i = 0; i < vm->string_intern_capacity; i++) {
+        hlffi_string_intern_entry* e = vm->string_intern[i];
+        while (e) {
+            hlffi_string_intern_entry* next = e->next;
+            hl_remove_root(&e->value.hl_value);
+            free(e->key);
+            free(e);
+            e = next;
+        }
+    }
+    free(vm->string_intern);
+
+    vm->string_intern = NULL;
+    vm->string_intern_capacity = 0;
+    vm->string_intern_count = 0;
+}
+
 /* ========== STATIC FIELD ACCESS ========== */
 
 hlffi_value* hlffi_get_static_field(hlffi_vm* vm, const char* class_name, const char* field_name) {
@@ -282,25 +775,10 @@ hlffi_value* hlffi_get_static_field(hlffi_vm* vm, const char* class_name, const
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    /* Hash the class name (NO $ prefix for global_value access) */
-    int class_hash = hl_hash_utf8(class_name);
     int field_hash = hl_hash_utf8(field_name);
 
-    /* Find the class type */
-    hl_code* code = vm->module->code;
-    hl_type* class_type = NULL;
-
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type* t = code->types + i;
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            char* type_name = hl_to_utf8(t->obj->name);
-            int type_hash = type_name ? hl_hash_utf8(type_name) : 0;
-            if (type_name && type_hash == class_hash) {
-                class_type = t;
-                break;
-            }
-        }
-    }
+    /* Find the class type (NO $ prefix for global_value access) */
+    hl_type* class_type = hlffi_type_index_lookup_class(vm, class_name);
 
     if (!class_type) {
         char error_buf[256];
@@ -344,7 +822,7 @@ hlffi_value* hlffi_get_static_field(hlffi_vm* vm, const char* class_name, const
      * IMPORTANT: Primitive types (int, float, bool) are returned inline by hl_dyn_get*,
      * not as vdynamic pointers. We must use the correct accessor and box the result.
      */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) {
         set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate hlffi_value");
         return NULL;
@@ -423,24 +901,10 @@ hlffi_error_code hlffi_set_static_field(hlffi_vm* vm, const char* class_name, co
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    /* Hash the class name (NO $ prefix for global_value access) */
-    int class_hash = hl_hash_utf8(class_name);
     int field_hash = hl_hash_utf8(field_name);
 
-    /* Find the class type */
-    hl_code* code = vm->module->code;
-    hl_type* class_type = NULL;
-
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type* t = code->types + i;
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            char* type_name = hl_to_utf8(t->obj->name);
-            if (type_name && hl_hash_utf8(type_name) == class_hash) {
-                class_type = t;
-                break;
-            }
-        }
-    }
+    /* Find the class type (NO $ prefix for global_value access) */
+    hl_type* class_type = hlffi_type_index_lookup_class(vm, class_name);
 
     if (!class_type) {
         char error_buf[256];
@@ -530,6 +994,14 @@ hlffi_error_code hlffi_set_static_field(hlffi_vm* vm, const char* class_name, co
 
 /* ========== STATIC METHOD CALLS ========== */
 
+/* Fallback String check by name, for when the type index has no String class */
+static bool is_string_class_name(hl_type* t) {
+    if (!t->obj || !t->obj->name) return false;
+    char type_name_buf[128];
+    utostr(type_name_buf, sizeof(type_name_buf), t->obj->name);
+    return strcmp(type_name_buf, "String") == 0;
+}
+
 hlffi_value* hlffi_call_static(hlffi_vm* vm, const char* class_name, const char* method_name, int argc, hlffi_value** argv) {
     if (!vm) return NULL;
     if (!class_name || !method_name) {
@@ -551,24 +1023,10 @@ hlffi_value* hlffi_call_static(hlffi_vm* vm, const char* class_name, const char*
 
     HLFFI_UPDATE_STACK_TOP();  /* Fix GC stack scanning */
 
-    /* Hash the class name (NO $ prefix - use regular class for global_value access) */
-    int class_hash = hl_hash_utf8(class_name);
     int method_hash = hl_hash_utf8(method_name);
 
-    /* Find the class type */
-    hl_code* code = vm->module->code;
-    hl_type* class_type = NULL;
-
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type* t = code->types + i;
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            char* type_name = hl_to_utf8(t->obj->name);
-            if (type_name && hl_hash_utf8(type_name) == class_hash) {
-                class_type = t;
-                break;
-            }
-        }
-    }
+    /* Find the class type (NO $ prefix - use regular class for global_value access) */
+    hl_type* class_type = hlffi_type_index_lookup_class(vm, class_name);
 
     if (!class_type) {
         char error_buf[256];
@@ -633,14 +1091,11 @@ hlffi_value* hlffi_call_static(hlffi_vm* vm, const char* class_name, const char*
             vdynamic* arg = hl_args[i];
 
             if (arg && expected_type->kind == HOBJ && arg->t->kind == HBYTES) {
-                char type_name_buf[128];
-                if (expected_type->obj && expected_type->obj->name) {
-                    utostr(type_name_buf, sizeof(type_name_buf), expected_type->obj->name);
-                    if (strcmp(type_name_buf, "String") == 0) {
-                        vstring* bytes_str = (vstring*)arg;
-                        bytes_str->t = expected_type;
-                        hl_args[i] = (vdynamic*)bytes_str;
-                    }
+                /* Pointer compare against the String class resolved at load time */
+                bool is_string = vm->string_type ? expected_type == vm->string_type
+                                                 : is_string_class_name(expected_type);
+                if (is_string) {
+                    arg->t = expected_type;
                 }
             }
         }
@@ -655,6 +1110,7 @@ hlffi_value* hlffi_call_static(hlffi_vm* vm, const char* class_name, const char*
 
     /* Check for exception */
     if (isExc) {
+        hlffi_exception_capture(vm, result);
         set_error(vm, HLFFI_ERROR_EXCEPTION_THROWN, "Exception thrown during function call");
         return NULL;
     }
@@ -665,7 +1121,7 @@ hlffi_value* hlffi_call_static(hlffi_vm* vm, const char* class_name, const char*
         return hlffi_value_null(vm);
     }
 
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
     wrapped->hl_value = result;
     wrapped->is_rooted = false;
@@ -677,6 +1133,140 @@ hlffi_value* hlffi_call_static(hlffi_vm* vm, const char* class_name, const char*
 
 /* ========== PHASE 5: ARRAY OPERATIONS ========== */
 
+/*
+ * Runtime layout of Haxe Array objects. Field offsets are resolved by name:
+ * rt->fields_indexes covers inherited fields too, so ArrayBase's "length"
+ * comes before the storage field of both array classes.
+ * - hl.types.ArrayBytes_*: "length", "bytes" (raw elements), "size" (capacity)
+ * - hl.types.ArrayObj:     "length", "array" (varray*, its size is the capacity)
+ */
+typedef struct {
+    bool is_obj;                /* ArrayObj (pointer elements) vs ArrayBytes_* */
+    int length_offset;
+    int storage_offset;         /* "bytes" or "array" */
+    int size_offset;            /* "size" (ArrayBytes_* only) */
+    hl_type_kind elem_kind;     /* HI32/HF32/HF64/HBOOL/HUI16, HDYN for ArrayObj */
+    int elem_size;
+} haxe_array_layout;
+
+static int field_offset_by_name(hl_type* t, const char* name) {
+    hl_field_lookup* l = obj_resolve_field(t->obj, hl_hash_utf8(name));
+    return (l && l->field_index >= 0) ? l->field_index : -1;
+}
+
+static bool resolve_haxe_array(vdynamic* obj, haxe_array_layout* out) {
+    if (obj->t->kind != HOBJ || !obj->t->obj || !obj->t->obj->name) return false;
+
+    char type_name[128];
+    utostr(type_name, sizeof(type_name), obj->t->obj->name);
+
+    if (strcmp(type_name, "hl.types.ArrayObj") == 0) {
+        out->is_obj = true;
+        out->elem_kind = HDYN;
+        out->elem_size = sizeof(void*);
+    } else if (strncmp(type_name, "hl.types.ArrayBytes_", 20) == 0) {
+        const char* suffix = type_name + 20;
+        out->is_obj = false;
+        if (strcmp(suffix, "Int") == 0)       { out->elem_kind = HI32;  out->elem_size = 4; }
+        else if (strcmp(suffix, "F32") == 0)  { out->elem_kind = HF32;  out->elem_size = 4; }
+        else if (strcmp(suffix, "F64") == 0)  { out->elem_kind = HF64;  out->elem_size = 8; }
+        else if (strcmp(suffix, "UI8") == 0)  { out->elem_kind = HBOOL; out->elem_size = 1; }  /* Array<Bool> */
+        else if (strcmp(suffix, "UI16") == 0) { out->elem_kind = HUI16; out->elem_size = 2; }
+        else return false;
+    } else {
+        return false;
+    }
+
+    if (!obj->t->obj->rt && !hl_get_obj_rt(obj->t)) return false;
+
+    out->length_offset = field_offset_by_name(obj->t, "length");
+    out->storage_offset = field_offset_by_name(obj->t, out->is_obj ? "array" : "bytes");
+    out->size_offset = out->is_obj ? -1 : field_offset_by_name(obj->t, "size");
+    return out->length_offset >= 0 && out->storage_offset >= 0 &&
+           (out->is_obj || out->size_offset >= 0);
+}
+
+#define HAXE_ARRAY_FIELD(obj, offset, type) (*(type*)((char*)(obj) + (offset)))
+
+/* hl.types.ArrayDyn forwards to the Array object in its "array" field */
+static vdynamic* unwrap_array_dyn(vdynamic* val) {
+    if (val->t->kind != HOBJ || !val->t->obj || !val->t->obj->name) return val;
+
+    char type_name[128];
+    utostr(type_name, sizeof(type_name), val->t->obj->name);
+    if (strcmp(type_name, "hl.types.ArrayDyn") != 0) return val;
+
+    if (!val->t->obj->rt && !hl_get_obj_rt(val->t)) return val;
+    int offset = field_offset_by_name(val->t, "array");
+    vdynamic* inner = offset >= 0 ? HAXE_ARRAY_FIELD(val, offset, vdynamic*) : NULL;
+    return inner ? inner : val;
+}
+
+static int haxe_array_length(vdynamic* obj, const haxe_array_layout* l) {
+    return HAXE_ARRAY_FIELD(obj, l->length_offset, int);
+}
+
+static int haxe_array_capacity(vdynamic* obj, const haxe_array_layout* l) {
+    int capacity;
+    if (l->is_obj) {
+        varray* inner = HAXE_ARRAY_FIELD(obj, l->storage_offset, varray*);
+        capacity = inner ? inner->size : 0;
+    } else {
+        capacity = HAXE_ARRAY_FIELD(obj, l->size_offset, int);
+    }
+    /* Never report less than the used length */
+    int length = haxe_array_length(obj, l);
+    return capacity < length ? length : capacity;
+}
+
+static void* haxe_array_data(vdynamic* obj, const haxe_array_layout* l) {
+    if (l->is_obj) {
+        varray* inner = HAXE_ARRAY_FIELD(obj, l->storage_offset, varray*);
+        return inner ? hl_aptr(inner, void) : NULL;
+    }
+    return HAXE_ARRAY_FIELD(obj, l->storage_offset, void*);
+}
+
+/* Growth policy of ArrayBytes/ArrayObj.__expand: x1.5, at least what is needed */
+static int haxe_array_grown_capacity(int capacity, int needed) {
+    int grown = (capacity * 3) >> 1;
+    return grown < needed ? needed : grown;
+}
+
+/* Reallocate storage to exactly `capacity` elements (>= length), keeping the
+ * used part and zeroing the rest - same as __expand in the Haxe std */
+static bool haxe_array_realloc(hlffi_vm* vm, vdynamic* obj, const haxe_array_layout* l, int capacity) {
+    int length = haxe_array_length(obj, l);
+    void* old_data = haxe_array_data(obj, l);
+
+    HLFFI_UPDATE_STACK_TOP();
+
+    if (l->is_obj) {
+        varray* old_array = HAXE_ARRAY_FIELD(obj, l->storage_offset, varray*);
+        varray* grown = hl_alloc_array(old_array ? old_array->at : &hlt_dyn, capacity);
+        if (!grown) {
+            set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to grow array");
+            return false;
+        }
+        void** data = hl_aptr(grown, void*);
+        if (length > 0 && old_data) memcpy(data, old_data, (size_t)length * sizeof(void*));
+        memset(data + length, 0, (size_t)(capacity - length) * sizeof(void*));
+        HAXE_ARRAY_FIELD(obj, l->storage_offset, varray*) = grown;
+        return true;
+    }
+
+    char* bytes = (char*)hl_gc_alloc_noptr(capacity * l->elem_size);
+    if (!bytes) {
+        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to grow array");
+        return false;
+    }
+    if (length > 0 && old_data) memcpy(bytes, old_data, (size_t)length * l->elem_size);
+    memset(bytes + (size_t)length * l->elem_size, 0, (size_t)(capacity - length) * l->elem_size);
+    HAXE_ARRAY_FIELD(obj, l->storage_offset, void*) = bytes;
+    HAXE_ARRAY_FIELD(obj, l->size_offset, int) = capacity;
+    return true;
+}
+
 /**
  * Helper: Find Haxe Array wrapper type by element type
  * Returns hl.types.ArrayBytes_Int, ArrayBytes_F64, ArrayObj, etc.
@@ -691,12 +1281,13 @@ static hl_type* find_haxe_array_type(hlffi_vm* vm, hl_type* element_type) {
         return NULL;
     }
 
-    hl_code* code = vm->module->code;
     const char* array_type_name = NULL;
 
     /* Determine the Haxe Array type name based on element type */
     if (!element_type || element_type->kind == HDYN) {
-        array_type_name = "hl.types.ArrayDyn";
+        /* Array<Dynamic> is an ArrayObj; ArrayDyn wraps another Array object
+         * and cannot hold a varray */
+        array_type_name = "hl.types.ArrayObj";
     } else if (element_type->kind == HI32) {
         array_type_name = "hl.types.ArrayBytes_Int";
     } else if (element_type->kind == HF32) {
@@ -711,20 +1302,8 @@ static hl_type* find_haxe_array_type(hlffi_vm* vm, hl_type* element_type) {
         array_type_name = "hl.types.ArrayObj";
     }
 
-    /* Search for the type in the module */
-    int hash = hl_hash_utf8(array_type_name);
-    for (int i = 0; i < code->ntypes; i++) {
-        hl_type* t = code->types + i;
-        if (t->kind == HOBJ && t->obj && t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), t->obj->name);
-            if (hl_hash_utf8(type_name) == hash) {
-                return t;
-            }
-        }
-    }
-
-    return NULL;
+    /* Look the type up in the module's type name index */
+    return hlffi_type_index_lookup_class(vm, array_type_name);
 #endif /* HLFFI_HLC_MODE */
 }
 
@@ -759,27 +1338,19 @@ static vdynamic* wrap_varray_as_haxe_array(hlffi_vm* vm, varray* arr) {
         return NULL;
     }
 
-    /* ArrayObj vs ArrayBytes_* have different field structures:
-     * - ArrayObj: single "array" field (varray*)
-     * - ArrayBytes_*: "bytes" and "size" fields
-     */
-    char type_name[128];
-    utostr(type_name, sizeof(type_name), array_type->obj->name);
-
-    if (strstr(type_name, "ArrayObj")) {
-        /* ArrayObj: single field [0] = array (varray*)
-         * Use runtime's field index to get correct offset */
-        int field_offset = rt->fields_indexes[0];  /* field 0 is "array" */
-        varray** array_field = (varray**)((char*)obj + field_offset);
-        *array_field = arr;
-    } else {
-        /* ArrayBytes_*: fields [0] = bytes, [1] = size
-         * But memory layout is [size(int), bytes(ptr)] due to alignment */
-        int* size_ptr = (int*)(obj + 1);
-        *size_ptr = arr->size;
+    /* ArrayObj stores the varray itself; ArrayBytes_* point at its elements */
+    haxe_array_layout layout;
+    if (!resolve_haxe_array((vdynamic*)obj, &layout) || layout.is_obj != hl_is_ptr(arr->at)) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Unsupported Array element type");
+        return NULL;
+    }
 
-        void** bytes_ptr = (void**)((char*)(obj + 1) + sizeof(void*));
-        *bytes_ptr = hl_aptr(arr, void);
+    HAXE_ARRAY_FIELD(obj, layout.length_offset, int) = arr->size;
+    if (layout.is_obj) {
+        HAXE_ARRAY_FIELD(obj, layout.storage_offset, varray*) = arr;
+    } else {
+        HAXE_ARRAY_FIELD(obj, layout.storage_offset, void*) = hl_aptr(arr, void);
+        HAXE_ARRAY_FIELD(obj, layout.size_offset, int) = arr->size;
     }
 
     return (vdynamic*)obj;
@@ -829,7 +1400,7 @@ hlffi_value* hlffi_array_new(hlffi_vm* vm, hl_type* element_type, int length) {
     }
 
     /* Wrap in hlffi_value */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
     wrapped->hl_value = result;
     wrapped->is_rooted = false;
@@ -842,184 +1413,136 @@ int hlffi_array_length(hlffi_value* arr) {
 
     vdynamic* val = arr->hl_value;
 
-    /* Debug: print actual type */
-
     /* Arrays can be wrapped in dynamic values */
     if (val->t->kind == HDYN && val->v.ptr) {
-        /* Unwrap dynamic */
         val = (vdynamic*)val->v.ptr;
     }
 
-    /* Check if this is actually an array */
     /* Note: Haxe Arrays can be HOBJ (11) or HARRAY (12) depending on context */
-    if (val->t->kind == HOBJ) {
-        /* For objects, check if it's a Haxe Array by looking at type name */
-        if (val->t->obj && val->t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), val->t->obj->name);
-
-            /* Check if this is a HashLink Array type (e.g., "hl.types.ArrayBytes_Int") */
-            if (strncmp(type_name, "hl.types.Array", 14) == 0) {
-                vobj* obj = (vobj*)val;
-
-                if (strstr(type_name, "ArrayObj")) {
-                    /* ArrayObj: single field [0] = array (varray*)
-                     * Use runtime's field index for correct offset */
-                    hl_runtime_obj* rt = val->t->obj->rt;
-                    if (!rt) rt = hl_get_obj_proto(val->t);
-                    int field_offset = rt->fields_indexes[0];
-                    varray** array_field = (varray**)((char*)obj + field_offset);
-                    varray* inner_arr = *array_field;
-                    return inner_arr ? inner_arr->size : 0;
-                } else {
-                    /* ArrayBytes_*: memory layout is [size(int), bytes(ptr)] */
-                    int* size_ptr = (int*)(obj + 1);
-                    return *size_ptr;
-                }
-            }
-        }
-        return -1;
-    } else if (val->t->kind == HARRAY) {
-        /* Direct varray */
-        varray* array = (varray*)val;
-        return array->size;
-    } else {
-        return -1;
+    if (val->t->kind == HARRAY) {
+        return ((varray*)val)->size;
     }
-}
-
-hlffi_value* hlffi_array_get(hlffi_vm* vm, hlffi_value* arr, int index) {
-    if (!vm || !arr || !arr->hl_value) return NULL;
 
-    vdynamic* val = arr->hl_value;
+    val = unwrap_array_dyn(val);
+    haxe_array_layout layout;
+    if (resolve_haxe_array(val, &layout)) {
+        return haxe_array_length(val, &layout);
+    }
+    return -1;
+}
 
+/* Element storage of an array value: kind, data pointer and used length */
+static bool array_storage(vdynamic* val, hl_type_kind* kind, void** data, int* length) {
     /* Arrays can be wrapped in dynamic values */
     if (val->t->kind == HDYN && val->v.ptr) {
         val = (vdynamic*)val->v.ptr;
     }
 
-    varray* array = NULL;
-
     /* Handle both HARRAY (raw varray) and HOBJ (Haxe Array object) */
     if (val->t->kind == HARRAY) {
-        array = (varray*)val;
-    } else if (val->t->kind == HOBJ) {
-        /* Check if this is a Haxe Array object */
-        if (val->t->obj && val->t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), val->t->obj->name);
-
-            if (strncmp(type_name, "hl.types.Array", 14) == 0) {
-                vobj* obj = (vobj*)val;
-
-                /* ArrayObj has different structure than ArrayBytes_* */
-                if (strstr(type_name, "ArrayObj")) {
-                    /* ArrayObj: single field [0] = array (varray*)
-                     * Use runtime's field index for correct offset */
-                    hl_runtime_obj* rt = val->t->obj->rt;
-                    if (!rt) rt = hl_get_obj_proto(val->t);
-                    int field_offset = rt->fields_indexes[0];
-                    varray** array_field = (varray**)((char*)obj + field_offset);
-                    array = *array_field;
-                    /* Continue to normal varray access below */
-                } else {
-                    /* ArrayBytes_*: fields with optimized memory layout */
-                    /* Field names: [0]="bytes", [1]="size" but memory: [0]=size(int), [1]=bytes(ptr) */
-
-                    /* Read size - first field is int (4 bytes) */
-                    int* size_ptr = (int*)(obj + 1);
-                    int size = *size_ptr;
-
-                    /* Read bytes pointer - second field, aligned to pointer size */
-                    void** bytes_ptr = (void**)((char*)(obj + 1) + sizeof(void*));
-                    void* bytes = *bytes_ptr;
-
-                    if (bytes && index >= 0 && index < size) {
-                    /* Access bytes as raw typed data based on array element type */
-                    if (strstr(type_name, "_Int")) {
-                        int* data = (int*)bytes;
-                        return hlffi_value_int(vm, data[index]);
-                    } else if (strstr(type_name, "_F32")) {
-                        float* data = (float*)bytes;
-                        return hlffi_value_f32(vm, data[index]);
-                    } else if (strstr(type_name, "_F64")) {
-                        double* data = (double*)bytes;
-                        return hlffi_value_float(vm, data[index]);
-                    } else if (strstr(type_name, "_UI8")) {
-                        unsigned char* data = (unsigned char*)bytes;
-                        return hlffi_value_bool(vm, data[index] != 0);
-                    } else if (strstr(type_name, "Dyn") || strstr(type_name, "Obj")) {
-                        /* Dynamic or object arrays store vdynamic* pointers */
-                        vdynamic** data = (vdynamic**)bytes;
-                        vdynamic* elem = data[index];
-
-                        if (!elem) {
-                            return hlffi_value_null(vm);
-                        }
-
-                        /* Wrap the element */
-                        hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
-                        if (!wrapped) return NULL;
-                        wrapped->hl_value = elem;
-                        wrapped->is_rooted = false;
-                        return wrapped;
-                        }
-                        /* TODO: Add support for String, Bool arrays */
-                    }
-                    set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Array index out of bounds or unsupported type");
-                    return NULL;
-                }  /* End of else (ArrayBytes_*) */
-            }  /* End of if Array type */
+        varray* array = (varray*)val;
+        *kind = array->at->kind;
+        *data = hl_aptr(array, void);
+        *length = array->size;
+        return true;
+    }
+
+    val = unwrap_array_dyn(val);
+    haxe_array_layout layout;
+    if (!resolve_haxe_array(val, &layout)) return false;
+    *kind = layout.elem_kind;
+    *data = haxe_array_data(val, &layout);
+    *length = haxe_array_length(val, &layout);
+    return true;
+}
+
+static hlffi_value* read_element(hlffi_vm* vm, hl_type_kind kind, void* data, int index) {
+    switch (kind) {
+        case HI32:  return hlffi_value_int(vm, ((int*)data)[index]);
+        case HUI16: return hlffi_value_int(vm, ((unsigned short*)data)[index]);
+        case HUI8:  return hlffi_value_int(vm, ((unsigned char*)data)[index]);
+        case HF32:  return hlffi_value_f32(vm, ((float*)data)[index]);
+        case HF64:  return hlffi_value_float(vm, ((double*)data)[index]);
+        case HBOOL: return hlffi_value_bool(vm, ((unsigned char*)data)[index] != 0);
+        default: {
+            /* Pointer types (dynamic, object, string, etc.) */
+            vdynamic* elem = ((vdynamic**)data)[index];
+            if (!elem) {
+                return hlffi_value_null(vm);
+            }
+
+            /* Wrap the element */
+            hlffi_value* wrapped = hlffi_value_alloc(vm);
+            if (!wrapped) return NULL;
+            wrapped->hl_value = elem;
+            wrapped->is_rooted = false;
+            return wrapped;
         }
     }
+}
+
+static void write_element(hl_type_kind kind, void* data, int index, hlffi_value* value) {
+    switch (kind) {
+        case HI32:  ((int*)data)[index] = hlffi_value_as_int(value, 0); break;
+        case HUI16: ((unsigned short*)data)[index] = (unsigned short)hlffi_value_as_int(value, 0); break;
+        case HUI8:  ((unsigned char*)data)[index] = (unsigned char)hlffi_value_as_int(value, 0); break;
+        case HF32:  ((float*)data)[index] = hlffi_value_as_f32(value, 0.0f); break;
+        case HF64:  ((double*)data)[index] = hlffi_value_as_float(value, 0.0); break;
+        case HBOOL: ((unsigned char*)data)[index] = hlffi_value_as_bool(value, false) ? 1 : 0; break;
+        default:
+            /* Pointer types */
+            ((vdynamic**)data)[index] = value ? value->hl_value : NULL;
+            break;
+    }
+}
+
+hlffi_value* hlffi_array_get(hlffi_vm* vm, hlffi_value* arr, int index) {
+    if (!vm || !arr || !arr->hl_value) return NULL;
 
-    if (!array) {
+    hl_type_kind kind;
+    void* data;
+    int length;
+    if (!array_storage(arr->hl_value, &kind, &data, &length)) {
         set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
         return NULL;
     }
 
     /* Bounds check */
-    if (index < 0 || index >= array->size) {
+    if (index < 0 || index >= length || !data) {
         set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Array index out of bounds");
         return NULL;
     }
 
-    hl_type* elem_type = array->at;
-
-    /* Get element based on type */
-    if (elem_type->kind == HI32) {
-        int* data = (int*)hl_aptr(array, int);
-        return hlffi_value_int(vm, data[index]);
-    } else if (elem_type->kind == HF32) {
-        float* data = (float*)hl_aptr(array, float);
-        return hlffi_value_f32(vm, data[index]);
-    } else if (elem_type->kind == HF64) {
-        double* data = (double*)hl_aptr(array, double);
-        return hlffi_value_float(vm, data[index]);
-    } else if (elem_type->kind == HBOOL) {
-        bool* data = (bool*)hl_aptr(array, bool);
-        return hlffi_value_bool(vm, data[index]);
-    } else {
-        /* Pointer types (dynamic, object, string, etc.) */
-        vdynamic** data = (vdynamic**)hl_aptr(array, vdynamic*);
-        vdynamic* elem = data[index];
-
-        if (!elem) {
-            return hlffi_value_null(vm);
-        }
-
-        /* Wrap the element */
-        hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
-        if (!wrapped) return NULL;
-        wrapped->hl_value = elem;
-        wrapped->is_rooted = false;
-        return wrapped;
-    }
+    return read_element(vm, kind, data, index);
 }
 
 bool hlffi_array_set(hlffi_vm* vm, hlffi_value* arr, int index, hlffi_value* value) {
     if (!vm || !arr || !arr->hl_value) return false;
 
+    hl_type_kind kind;
+    void* data;
+    int length;
+    if (!array_storage(arr->hl_value, &kind, &data, &length)) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
+        return false;
+    }
+
+    /* Bounds check */
+    if (index < 0 || index >= length || !data) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Array index out of bounds");
+        return false;
+    }
+
+    write_element(kind, data, index, value);
+    return true;
+}
+
+/*
+ * Resolve the Haxe Array object behind arr for appending. A raw varray
+ * (fixed size) is first copied into a new Haxe Array object with room for
+ * `extra` more elements, and arr is updated to point to it.
+ */
+static vdynamic* array_for_append(hlffi_vm* vm, hlffi_value* arr, int extra, haxe_array_layout* layout) {
     vdynamic* val = arr->hl_value;
 
     /* Arrays can be wrapped in dynamic values */
@@ -1027,216 +1550,359 @@ bool hlffi_array_set(hlffi_vm* vm, hlffi_value* arr, int index, hlffi_value* val
         val = (vdynamic*)val->v.ptr;
     }
 
-    varray* array = NULL;
-
-    /* Handle both HARRAY (raw varray) and HOBJ (Haxe Array object) */
     if (val->t->kind == HARRAY) {
-        array = (varray*)val;
-    } else if (val->t->kind == HOBJ) {
-        /* Check if this is a Haxe Array object */
-        if (val->t->obj && val->t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), val->t->obj->name);
-
-            if (strncmp(type_name, "hl.types.Array", 14) == 0) {
-                vobj* obj = (vobj*)val;
-
-                /* ArrayObj has different structure than ArrayBytes_* */
-                if (strstr(type_name, "ArrayObj")) {
-                    /* ArrayObj: single field [0] = array (varray*)
-                     * Use runtime's field index for correct offset */
-                    hl_runtime_obj* rt = val->t->obj->rt;
-                    if (!rt) rt = hl_get_obj_proto(val->t);
-                    int field_offset = rt->fields_indexes[0];
-                    varray** array_field = (varray**)((char*)obj + field_offset);
-                    array = *array_field;
-                    /* Continue to normal varray access below */
-                } else {
-                    /* ArrayBytes_*: use direct memory access */
-                    /* Memory layout: [size(int), bytes(ptr)] */
-
-                    /* Read size - first field */
-                    int* size_ptr = (int*)(obj + 1);
-                    int size = *size_ptr;
-
-                    /* Read bytes pointer - second field, aligned to pointer size */
-                    void** bytes_ptr = (void**)((char*)(obj + 1) + sizeof(void*));
-                    void* bytes = *bytes_ptr;
-
-                    /* Bounds check */
-                    if (index < 0 || index >= size) {
-                        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Array index out of bounds");
-                        return false;
-                    }
-
-                    /* Set element based on array type */
-                    if (strstr(type_name, "_Int")) {
-                        int* data = (int*)bytes;
-                        data[index] = hlffi_value_as_int(value, 0);
-                        return true;
-                    } else if (strstr(type_name, "_F32")) {
-                        float* data = (float*)bytes;
-                        data[index] = hlffi_value_as_f32(value, 0.0f);
-                        return true;
-                    } else if (strstr(type_name, "_F64")) {
-                        double* data = (double*)bytes;
-                        data[index] = hlffi_value_as_float(value, 0.0);
-                        return true;
-                    } else if (strstr(type_name, "_UI8")) {
-                        unsigned char* data = (unsigned char*)bytes;
-                        data[index] = hlffi_value_as_bool(value, false) ? 1 : 0;
-                        return true;
-                    } else if (strstr(type_name, "Dyn") || strstr(type_name, "Obj")) {
-                        vdynamic** data = (vdynamic**)bytes;
-                        data[index] = value ? value->hl_value : NULL;
-                        return true;
-                    }
-
-                    set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Unsupported array element type");
-                    return false;
-                }  /* End of else (ArrayBytes_*) */
-            }  /* End of if Array type */
+        varray* old_array = (varray*)val;
+        int length = old_array->size;
+
+        HLFFI_UPDATE_STACK_TOP();
+
+        varray* grown = hl_alloc_array(old_array->at, haxe_array_grown_capacity(length, length + extra));
+        if (!grown) {
+            set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate new array");
+            return NULL;
+        }
+        int elem_size = hl_type_size(old_array->at);
+        memcpy(hl_aptr(grown, void), hl_aptr(old_array, void), (size_t)length * elem_size);
+        memset(hl_aptr(grown, char) + (size_t)length * elem_size, 0,
+               (size_t)(grown->size - length) * elem_size);
+
+        /* Wrap as Haxe Array: capacity is the varray size, length the old size */
+        vdynamic* wrapped = wrap_varray_as_haxe_array(vm, grown);
+        if (!wrapped || !resolve_haxe_array(wrapped, layout)) {
+            set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Cannot append to this native array");
+            return NULL;
         }
+        HAXE_ARRAY_FIELD(wrapped, layout->length_offset, int) = length;
+
+        /* Replace old array with new one */
+        arr->hl_value = wrapped;
+        return wrapped;
     }
 
-    if (!array) {
+    val = unwrap_array_dyn(val);
+    if (!resolve_haxe_array(val, layout)) {
         set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
-        return false;
+        return NULL;
     }
+    return val;
+}
 
-    /* Bounds check */
-    if (index < 0 || index >= array->size) {
-        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Array index out of bounds");
+/* Make room for `extra` elements past the current length (amortized O(1)) */
+static bool array_reserve_append(hlffi_vm* vm, vdynamic* obj, const haxe_array_layout* layout, int extra) {
+    int needed = haxe_array_length(obj, layout) + extra;
+    int capacity = haxe_array_capacity(obj, layout);
+    if (needed <= capacity && haxe_array_data(obj, layout)) return true;
+    return haxe_array_realloc(vm, obj, layout, haxe_array_grown_capacity(capacity, needed));
+}
+
+bool hlffi_array_push(hlffi_vm* vm, hlffi_value* arr, hlffi_value* value) {
+    if (!vm || !arr || !arr->hl_value) return false;
+
+    haxe_array_layout layout;
+    vdynamic* obj = array_for_append(vm, arr, 1, &layout);
+    if (!obj || !array_reserve_append(vm, obj, &layout, 1)) return false;
+
+    /* Append in place into spare capacity */
+    int length = haxe_array_length(obj, &layout);
+    write_element(layout.elem_kind, haxe_array_data(obj, &layout), length, value);
+    HAXE_ARRAY_FIELD(obj, layout.length_offset, int) = length + 1;
+    return true;
+}
+
+bool hlffi_array_push_n(hlffi_vm* vm, hlffi_value* arr, const void* data, int count) {
+    if (!vm || !arr || !arr->hl_value) return false;
+    if (count < 0 || (count > 0 && !data)) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Invalid buffer or count");
         return false;
     }
+    if (count == 0) return true;
+
+    haxe_array_layout layout;
+    vdynamic* obj = array_for_append(vm, arr, count, &layout);
+    if (!obj || !array_reserve_append(vm, obj, &layout, count)) return false;
+
+    int length = haxe_array_length(obj, &layout);
+    char* dst = (char*)haxe_array_data(obj, &layout) + (size_t)length * layout.elem_size;
 
-    hl_type* elem_type = array->at;
-
-    /* Set element based on type */
-    if (elem_type->kind == HI32) {
-        int* data = (int*)hl_aptr(array, int);
-        data[index] = hlffi_value_as_int(value, 0);
-    } else if (elem_type->kind == HF32) {
-        float* data = (float*)hl_aptr(array, float);
-        data[index] = hlffi_value_as_f32(value, 0.0f);
-    } else if (elem_type->kind == HF64) {
-        double* data = (double*)hl_aptr(array, double);
-        data[index] = hlffi_value_as_float(value, 0.0);
-    } else if (elem_type->kind == HBOOL) {
-        bool* data = (bool*)hl_aptr(array, bool);
-        data[index] = hlffi_value_as_bool(value, false);
+    if (layout.is_obj) {
+        /* Object arrays: data is an array of hlffi_value* */
+        hlffi_value* const* values = (hlffi_value* const*)data;
+        vdynamic** slots = (vdynamic**)dst;
+        for (int i = 0; i < count; i++) {
+            slots[i] = values[i] ? values[i]->hl_value : NULL;
+        }
     } else {
-        /* Pointer types */
-        vdynamic** data = (vdynamic**)hl_aptr(array, vdynamic*);
-        data[index] = value ? value->hl_value : NULL;
+        /* Numeric arrays: data has the element representation - one copy */
+        memcpy(dst, data, (size_t)count * layout.elem_size);
     }
 
+    HAXE_ARRAY_FIELD(obj, layout.length_offset, int) = length + count;
     return true;
 }
 
-bool hlffi_array_push(hlffi_vm* vm, hlffi_value* arr, hlffi_value* value) {
-    /* Note: HashLink arrays are fixed-size, so push requires creating a new array
-     * This is a convenience function that creates a new array with size+1 and copies data */
+/* ========== Bulk Import/Export ========== */
+
+/* Element kind matching a C buffer type for bulk copies */
+static hl_type_kind bulk_elem_kind(hlffi_type_kind type, int* elem_size) {
+    switch (type) {
+        case HLFFI_TYPE_I32:  *elem_size = sizeof(int32_t); return HI32;
+        case HLFFI_TYPE_F32:  *elem_size = sizeof(float);   return HF32;
+        case HLFFI_TYPE_F64:  *elem_size = sizeof(double);  return HF64;
+        case HLFFI_TYPE_BOOL: *elem_size = 1;               return HBOOL;
+        default:              *elem_size = 0;               return HVOID;
+    }
+}
+
+int hlffi_array_export(hlffi_vm* vm, hlffi_value* arr, hlffi_type_kind type, void* out, int max_count) {
+    if (!vm || !arr || !arr->hl_value) return -1;
+
+    int elem_size;
+    hl_type_kind want = bulk_elem_kind(type, &elem_size);
+
+    hl_type_kind kind;
+    void* data;
+    int length;
+    if (want == HVOID || !array_storage(arr->hl_value, &kind, &data, &length) || kind != want) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Bulk copy requires an Int/Single/Float/Bool array of the requested type");
+        return -1;
+    }
+
+    /* Size query */
+    if (!out) return length;
+
+    int count = length < max_count ? length : max_count;
+    if (count > 0 && data) {
+        memcpy(out, data, (size_t)count * elem_size);
+    }
+    return count < 0 ? 0 : count;
+}
+
+bool hlffi_array_import(hlffi_vm* vm, hlffi_value* arr, hlffi_type_kind type, const void* data, int count) {
     if (!vm || !arr || !arr->hl_value) return false;
+    if (count < 0 || (count > 0 && !data)) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Invalid buffer or count");
+        return false;
+    }
 
-    vdynamic* val = arr->hl_value;
+    int elem_size;
+    hl_type_kind want = bulk_elem_kind(type, &elem_size);
 
-    /* Arrays can be wrapped in dynamic values */
+    vdynamic* val = arr->hl_value;
     if (val->t->kind == HDYN && val->v.ptr) {
         val = (vdynamic*)val->v.ptr;
     }
 
-    /* Extract array info - handle both HARRAY (raw) and HOBJ (wrapped) */
-    int old_size;
-    hl_type* elem_type;
-    void* old_data;
-
+    /* Raw varray: fixed size, overwrite the first count elements */
     if (val->t->kind == HARRAY) {
-        /* Raw varray */
-        varray* old_array = (varray*)val;
-        old_size = old_array->size;
-        elem_type = old_array->at;
-        old_data = hl_aptr(old_array, void);
-    } else if (val->t->kind == HOBJ) {
-        /* Wrapped Haxe Array - extract fields */
-        if (val->t->obj && val->t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), val->t->obj->name);
-
-            if (strncmp(type_name, "hl.types.Array", 14) == 0) {
-                vobj* obj = (vobj*)val;
-
-                /* Read size - first field */
-                int* size_ptr = (int*)(obj + 1);
-                old_size = *size_ptr;
-
-                /* Read bytes pointer - second field */
-                void** bytes_ptr = (void**)((char*)(obj + 1) + sizeof(void*));
-                old_data = *bytes_ptr;
-
-                /* Determine element type from array type name */
-                if (strstr(type_name, "_Int")) {
-                    elem_type = &hlt_i32;
-                } else if (strstr(type_name, "_F64")) {
-                    elem_type = &hlt_f64;
-                } else {
-                    elem_type = &hlt_dyn;  /* Dynamic or object array */
-                }
-            } else {
-                set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
-                return false;
-            }
-        } else {
-            set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
+        varray* array = (varray*)val;
+        if (want == HVOID || array->at->kind != want) {
+            set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "NativeArray element type does not match");
             return false;
         }
-    } else {
-        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
+        if (count > array->size) {
+            set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "NativeArray is smaller than the buffer");
+            return false;
+        }
+        if (count > 0) memcpy(hl_aptr(array, void), data, (size_t)count * elem_size);
+        return true;
+    }
+
+    val = unwrap_array_dyn(val);
+    haxe_array_layout layout;
+    if (want == HVOID || !resolve_haxe_array(val, &layout) || layout.elem_kind != want) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Bulk copy requires an Int/Single/Float/Bool array of the requested type");
         return false;
     }
 
-    HLFFI_UPDATE_STACK_TOP();
+    /* Reuse the existing store when it is large enough (steady-state: no allocation) */
+    int length = haxe_array_length(val, &layout);
+    if (count > haxe_array_capacity(val, &layout) || (count > 0 && !haxe_array_data(val, &layout))) {
+        HAXE_ARRAY_FIELD(val, layout.length_offset, int) = 0;  /* Nothing worth copying */
+        length = 0;
+        if (!haxe_array_realloc(vm, val, &layout, count)) return false;
+    }
+
+    char* dst = (char*)haxe_array_data(val, &layout);
+    if (count > 0) memcpy(dst, data, (size_t)count * elem_size);
+
+    /* Clear elements leaving the used range, as Array.resize does */
+    if (length > count) {
+        memset(dst + (size_t)count * elem_size, 0, (size_t)(length - count) * elem_size);
+    }
 
-    /* Allocate new varray with size+1 */
-    varray* new_varray = hl_alloc_array(elem_type, old_size + 1);
-    if (!new_varray) {
-        set_error(vm, HLFFI_ERROR_OUT_OF_MEMORY, "Failed to allocate new array");
+    HAXE_ARRAY_FIELD(val, layout.length_offset, int) = count;
+    return true;
+}
+
+bool hlffi_array_object_elements(vdynamic* arr, vdynamic*** out_data, int* out_count) {
+    if (!arr || !out_data || !out_count) return false;
+
+    vdynamic* val = arr;
+    if (val->t->kind == HDYN && val->v.ptr) {
+        val = (vdynamic*)val->v.ptr;
+    }
+
+    if (val->t->kind == HARRAY) {
+        varray* array = (varray*)val;
+        if (!hl_is_ptr(array->at)) return false;
+        *out_data = hl_aptr(array, vdynamic*);
+        *out_count = array->size;
+        return true;
+    }
+
+    haxe_array_layout layout;
+    if (!resolve_haxe_array(val, &layout) || !layout.is_obj) return false;
+
+    *out_data = (vdynamic**)haxe_array_data(val, &layout);
+    *out_count = *out_data ? haxe_array_length(val, &layout) : 0;
+    return true;
+}
+
+/* ========== Typed Array Views ========== */
+
+static hlffi_type_kind view_type_of(hl_type_kind kind) {
+    switch (kind) {
+        case HI32: return HLFFI_TYPE_I32;
+        case HF32: return HLFFI_TYPE_F32;
+        case HF64: return HLFFI_TYPE_F64;
+        default:   return HLFFI_TYPE_VOID;
+    }
+}
+
+/* Resolve the ArrayBytes_* layout of a pinned view (false for NativeArrays) */
+static bool view_layout(hlffi_array_view* view, haxe_array_layout* layout) {
+    vdynamic* obj = (vdynamic*)view->opaque;
+    return obj->t->kind == HOBJ && resolve_haxe_array(obj, layout) && !layout->is_obj;
+}
+
+/* Re-read data/length/capacity from the pinned array */
+static bool array_view_load(hlffi_array_view* view) {
+    vdynamic* obj = (vdynamic*)view->opaque;
+    if (!obj) return false;
+
+    if (obj->t->kind == HARRAY) {
+        varray* array = (varray*)obj;
+        view->data = hl_aptr(array, void);
+        view->length = array->size;
+        view->capacity = array->size;
+        view->type = view_type_of(array->at->kind);
+        return true;
+    }
+
+    haxe_array_layout layout;
+    if (!view_layout(view, &layout)) return false;
+
+    view->data = haxe_array_data(obj, &layout);
+    view->length = haxe_array_length(obj, &layout);
+    view->capacity = haxe_array_capacity(obj, &layout);
+    view->type = view_type_of(layout.elem_kind);
+    return true;
+}
+
+bool hlffi_array_view_pin(hlffi_vm* vm, hlffi_value* arr, hlffi_array_view* view) {
+    if (!vm || !view) return false;
+    memset(view, 0, sizeof(*view));
+
+    if (!arr || !arr->hl_value) {
+        set_error(vm, HLFFI_ERROR_NULL_VALUE, "Array is NULL");
         return false;
     }
 
-    /* Copy old data */
-    int elem_size = hl_type_size(elem_type);
-    void* new_data = hl_aptr(new_varray, void);
-    memcpy(new_data, old_data, old_size * elem_size);
-
-    /* Add new element at the end */
-    if (elem_type->kind == HI32) {
-        int* data = (int*)new_data;
-        data[old_size] = hlffi_value_as_int(value, 0);
-    } else if (elem_type->kind == HF64) {
-        double* data = (double*)new_data;
-        data[old_size] = hlffi_value_as_float(value, 0.0);
-    } else if (elem_type->kind == HBOOL) {
-        bool* data = (bool*)new_data;
-        data[old_size] = hlffi_value_as_bool(value, false);
-    } else {
-        vdynamic** data = (vdynamic**)new_data;
-        data[old_size] = value ? value->hl_value : NULL;
+    vdynamic* val = arr->hl_value;
+    if (val->t->kind == HDYN && val->v.ptr) {
+        val = (vdynamic*)val->v.ptr;
+    }
+
+    haxe_array_layout layout;
+    hl_type_kind kind = HVOID;
+    if (val->t->kind == HARRAY) {
+        kind = ((varray*)val)->at->kind;
+    } else if (resolve_haxe_array(val, &layout)) {
+        kind = layout.elem_kind;
+    }
+    if (view_type_of(kind) == HLFFI_TYPE_VOID) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH,
+                  "Array views require Array<Int>, Array<Float> or Array<Single> (or a NativeArray of those)");
+        return false;
+    }
+
+    /* Root the array object so the buffer outlives any Haxe reference */
+    view->opaque = val;
+    hl_add_root(&view->opaque);
+    return array_view_load(view);
+}
+
+bool hlffi_array_view_refresh(hlffi_array_view* view) {
+    return view && array_view_load(view);
+}
+
+bool hlffi_array_view_reserve(hlffi_vm* vm, hlffi_array_view* view, int capacity) {
+    if (!vm || !view || !view->opaque) return false;
+    if (capacity < 0) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Capacity must be >= 0");
+        return false;
     }
 
-    /* Wrap the new varray as a Haxe Array object */
-    vdynamic* new_wrapped = wrap_varray_as_haxe_array(vm, new_varray);
-    if (!new_wrapped) {
-        /* If wrapping fails, fall back to raw varray */
-        new_wrapped = (vdynamic*)new_varray;
+    /* Haxe code may have grown the array since the last load */
+    if (!array_view_load(view)) return false;
+    if (capacity <= view->capacity) return true;
+
+    haxe_array_layout layout;
+    if (!view_layout(view, &layout)) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "NativeArray views have a fixed size");
+        return false;
     }
 
-    /* Replace old array with new one */
-    arr->hl_value = new_wrapped;
+    if (!haxe_array_realloc(vm, (vdynamic*)view->opaque, &layout, capacity)) return false;
+    return array_view_load(view);
+}
 
+bool hlffi_array_view_resize(hlffi_vm* vm, hlffi_array_view* view, int length) {
+    if (!vm || !view || !view->opaque) return false;
+    if (length < 0) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Length must be >= 0");
+        return false;
+    }
+
+    if (!array_view_load(view)) return false;
+    if (length == view->length) return true;
+
+    haxe_array_layout layout;
+    if (!view_layout(view, &layout)) {
+        set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "NativeArray views have a fixed size");
+        return false;
+    }
+
+    vdynamic* obj = (vdynamic*)view->opaque;
+    if (length > view->capacity) {
+        /* Geometric growth (x1.5, like ArrayBytes) so repeated resizes amortize */
+        if (!haxe_array_realloc(vm, obj, &layout, haxe_array_grown_capacity(view->capacity, length))) {
+            return false;
+        }
+        if (!array_view_load(view)) return false;
+    } else {
+        /* Clear elements entering or leaving the used range, as ArrayBytes.resize does */
+        int from = length < view->length ? length : view->length;
+        int to = length < view->length ? view->length : length;
+        memset((char*)view->data + (size_t)from * layout.elem_size, 0,
+               (size_t)(to - from) * layout.elem_size);
+    }
+
+    HAXE_ARRAY_FIELD(obj, layout.length_offset, int) = length;
+    view->length = length;
     return true;
 }
 
+void hlffi_array_view_release(hlffi_array_view* view) {
+    if (!view) return;
+    if (view->opaque) {
+        hl_remove_root(&view->opaque);
+    }
+    memset(view, 0, sizeof(*view));
+}
+
 /* ========== NativeArray Support ========== */
 
 hlffi_value* hlffi_native_array_new(hlffi_vm* vm, hl_type* element_type, int length) {
@@ -1277,7 +1943,7 @@ hlffi_value* hlffi_native_array_new(hlffi_vm* vm, hl_type* element_type, int len
 
     /* Return unwrapped varray (no Haxe Array object wrapper) */
     /* Wrap in hlffi_value for API consistency */
-    hlffi_value* wrapped = (hlffi_value*)malloc(sizeof(hlffi_value));
+    hlffi_value* wrapped = hlffi_value_alloc(vm);
     if (!wrapped) return NULL;
     wrapped->hl_value = (vdynamic*)arr;
     wrapped->is_rooted = false;
@@ -1322,51 +1988,37 @@ hlffi_value* hlffi_array_new_struct(hlffi_vm* vm, hlffi_type* struct_type, int l
     return hlffi_array_new(vm, &hlt_dyn, length);
 }
 
-void* hlffi_array_get_struct(hlffi_value* arr, int index) {
-    if (!arr || !arr->hl_value) return NULL;
-
-    vdynamic* val = arr->hl_value;
+/*
+ * Element storage of an array of struct wrappers (pointer elements), through
+ * the same resolution as hlffi_array_get/set: raw varray, Haxe ArrayObj, or
+ * ArrayDyn forwarding to one. length is the used length, not the capacity.
+ */
+static vdynamic** struct_array_storage(vdynamic* val, int* length) {
+    hl_type_kind kind;
+    void* data;
+    if (!array_storage(val, &kind, &data, length)) return NULL;
 
-    /* Unwrap dynamic if needed */
-    if (val->t->kind == HDYN && val->v.ptr) {
-        val = (vdynamic*)val->v.ptr;
+    switch (kind) {
+        case HI32: case HUI16: case HUI8: case HF32: case HF64: case HBOOL: case HI64:
+            return NULL;  /* Scalar elements: no struct wrappers */
+        default:
+            return (vdynamic**)data;
     }
+}
 
-    varray* array = NULL;
-
-    /* Handle both HARRAY and HOBJ */
-    if (val->t->kind == HARRAY) {
-        array = (varray*)val;
-    } else if (val->t->kind == HOBJ) {
-        /* Extract varray from Haxe Array object */
-        if (val->t->obj && val->t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), val->t->obj->name);
-
-            if (strncmp(type_name, "hl.types.Array", 14) == 0) {
-                vobj* obj = (vobj*)val;
-
-                if (strstr(type_name, "ArrayObj") || strstr(type_name, "Dyn")) {
-                    /* ArrayObj: single field [0] = array (varray*) */
-                    hl_runtime_obj* rt = val->t->obj->rt;
-                    if (!rt) rt = hl_get_obj_proto(val->t);
-                    int field_offset = rt->fields_indexes[0];
-                    varray** array_field = (varray**)((char*)obj + field_offset);
-                    array = *array_field;
-                }
-            }
-        }
-    }
+void* hlffi_array_get_struct(hlffi_value* arr, int index) {
+    if (!arr || !arr->hl_value) return NULL;
 
-    if (!array) return NULL;
+    int length;
+    vdynamic** data = struct_array_storage(arr->hl_value, &length);
+    if (!data) return NULL;
 
     /* Bounds check */
-    if (index < 0 || index >= array->size) {
+    if (index < 0 || index >= length) {
         return NULL;
     }
 
     /* Get vdynamic* wrapper at index */
-    vdynamic** data = (vdynamic**)hl_aptr(array, vdynamic*);
     vdynamic* wrapper = data[index];
 
     if (!wrapper) return NULL;
@@ -1388,46 +2040,15 @@ void* hlffi_array_get_struct(hlffi_value* arr, int index) {
 bool hlffi_array_set_struct(hlffi_vm* vm, hlffi_value* arr, int index, void* struct_ptr, int struct_size) {
     if (!vm || !arr || !arr->hl_value || !struct_ptr) return false;
 
-    vdynamic* val = arr->hl_value;
-
-    /* Unwrap dynamic if needed */
-    if (val->t->kind == HDYN && val->v.ptr) {
-        val = (vdynamic*)val->v.ptr;
-    }
-
-    varray* array = NULL;
-
-    /* Handle both HARRAY and HOBJ */
-    if (val->t->kind == HARRAY) {
-        array = (varray*)val;
-    } else if (val->t->kind == HOBJ) {
-        /* Extract varray from Haxe Array object */
-        if (val->t->obj && val->t->obj->name) {
-            char type_name[128];
-            utostr(type_name, sizeof(type_name), val->t->obj->name);
-
-            if (strncmp(type_name, "hl.types.Array", 14) == 0) {
-                vobj* obj = (vobj*)val;
-
-                if (strstr(type_name, "ArrayObj") || strstr(type_name, "Dyn")) {
-                    /* ArrayObj: single field [0] = array (varray*) */
-                    hl_runtime_obj* rt = val->t->obj->rt;
-                    if (!rt) rt = hl_get_obj_proto(val->t);
-                    int field_offset = rt->fields_indexes[0];
-                    varray** array_field = (varray**)((char*)obj + field_offset);
-                    array = *array_field;
-                }
-            }
-        }
-    }
-
-    if (!array) {
-        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array");
+    int length;
+    vdynamic** data = struct_array_storage(arr->hl_value, &length);
+    if (!data) {
+        set_error(vm, HLFFI_ERROR_TYPE_MISMATCH, "Value is not an array of structs");
         return false;
     }
 
     /* Bounds check */
-    if (index < 0 || index >= array->size) {
+    if (index < 0 || index >= length) {
         set_error(vm, HLFFI_ERROR_INVALID_ARGUMENT, "Array index out of bounds");
         return false;
     }
@@ -1450,7 +2071,6 @@ bool hlffi_array_set_struct(hlffi_vm* vm, hlffi_value* arr, int index, void* str
     wrapper->v.ptr = dest;
 
     /* Store wrapper in array */
-    vdynamic** data = (vdynamic**)hl_aptr(array, vdynamic*);
     data[index] = wrapper;
 
     return true;
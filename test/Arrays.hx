@@ -142,6 +142,13 @@ class Arrays {
         return arr[arr.length - 1];
     }
 
+    /** Grow an array from Haxe (C views must refresh afterwards) */
+    public static function pushValues(arr:Array<Int>, count:Int):Void {
+        for (i in 0...count) {
+            arr.push(1000 + i);
+        }
+    }
+
     /* Test methods - modify arrays */
     public static function doubleValues(arr:Array<Int>):Array<Int> {
         var result = [];
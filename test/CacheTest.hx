@@ -3,8 +3,12 @@
  */
 class CacheTest {
     public static var counter:Int = 0;
+    public static var entities:Array<CacheEntity> = [];
 
     public static function main() {
+        // Keep instance classes alive for instance method caching
+        var e:CacheEntity = new FastCacheEntity();
+        e.update(0.0);
         trace("CacheTest initialized");
     }
 
@@ -23,8 +27,55 @@ class CacheTest {
         return "Hello, " + name + "!";
     }
 
+    // Event dispatch keyed by name (string argument, int result)
+    public static function onEvent(name:String):Int {
+        return name.length;
+    }
+
     // Method with float
     public static function multiply(a:Float, b:Float):Float {
         return a * b;
     }
+
+    // Fill entities with n instances (alternating base/subclass) for bulk field sync
+    public static function makeEntities(n:Int):Void {
+        entities = [];
+        for (i in 0...n) {
+            var e:CacheEntity = (i & 1) == 0 ? new CacheEntity() : new FastCacheEntity();
+            e.x = i;
+            entities.push(e);
+        }
+    }
+}
+
+/**
+ * Instance class for instance method caching
+ */
+class CacheEntity {
+    public var x:Float = 0.0;
+    public var speed:Float = 1.0;
+
+    public function new() {}
+
+    public function update(dt:Float):Void {
+        x += speed * dt;
+    }
+
+    public function getX():Float {
+        return x;
+    }
+}
+
+/**
+ * Subclass overriding update() - exercises per-type dispatch
+ */
+class FastCacheEntity extends CacheEntity {
+    public function new() {
+        super();
+        speed = 2.0;
+    }
+
+    override public function update(dt:Float):Void {
+        x += speed * dt * 2.0;
+    }
 }
@@ -11,6 +11,11 @@ class Callbacks {
     public static var onAdd:Dynamic = null;
     public static var onNotify:Dynamic = null;
     public static var onCompute:Dynamic = null;
+    public static var onCollision:Dynamic = null;
+
+    /* Typed callbacks - set via hlffi_register_callback_typed(), Int/Float/Bool passed unboxed */
+    public static var onImpact:(Int, Float, Bool)->Float = null;
+    public static var onImpactDynamic:Dynamic = null;
 
     /* Test counters */
     static var messageReceived:String = "";
@@ -124,6 +129,69 @@ class Callbacks {
         return computeResult;
     }
 
+    /**
+     * Benchmark helper: Fire onNotify() n times
+     */
+    public static function fireNotifies(n:Int):Int {
+        var fired = 0;
+        if (onNotify == null) return 0;
+        for (i in 0...n) {
+            onNotify();
+            fired++;
+        }
+        return fired;
+    }
+
+    /**
+     * Benchmark helper: Fire onCollision(a, b, x, y, impulse, solid) n times
+     */
+    public static function fireCollisions(n:Int):Int {
+        var fired = 0;
+        if (onCollision == null) return 0;
+        for (i in 0...n) {
+            onCollision(i, i + 1, i * 0.5, i * 0.25, 2.0, (i & 1) == 0);
+            fired++;
+        }
+        return fired;
+    }
+
+    /**
+     * Call the typed onImpact callback
+     */
+    public static function callImpactCallback(id:Int, force:Float, solid:Bool):Float {
+        if (onImpact != null) {
+            return onImpact(id, force, solid);
+        } else {
+            trace("ERROR: onImpact callback not set");
+            return -1.0;
+        }
+    }
+
+    /**
+     * Benchmark helper: Fire the typed onImpact n times, returns the summed results
+     */
+    public static function fireImpacts(n:Int):Float {
+        var total = 0.0;
+        if (onImpact == null) return total;
+        for (i in 0...n) {
+            total += onImpact(i, i * 0.5, (i & 1) == 0);
+        }
+        return total;
+    }
+
+    /**
+     * Benchmark helper: Same as fireImpacts through the Dynamic onImpactDynamic
+     */
+    public static function fireImpactsDynamic(n:Int):Float {
+        var total = 0.0;
+        if (onImpactDynamic == null) return total;
+        for (i in 0...n) {
+            var r:Float = onImpactDynamic(i, i * 0.5, (i & 1) == 0);
+            total += r;
+        }
+        return total;
+    }
+
     /**
      * Reset all test state
      */
@@ -136,5 +204,8 @@ class Callbacks {
         onAdd = null;
         onNotify = null;
         onCompute = null;
+        onCollision = null;
+        onImpact = null;
+        onImpactDynamic = null;
     }
 }
@@ -78,6 +78,18 @@ class Exceptions {
         middleThrow();
     }
 
+    /**
+     * Throws and catches internally (overwrites the runtime's last exception stack)
+     */
+    public static function throwAndCatch():Int {
+        try {
+            throw "Caught inside Haxe";
+        } catch (e:Dynamic) {
+            return 1;
+        }
+        return 0;
+    }
+
     /**
      * Entry point
      */
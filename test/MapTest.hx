@@ -3,7 +3,22 @@
  * Tests C<->Haxe map passing and manipulation
  */
 
+/** Key class for Map<MapKey, Int> (haxe.ds.ObjectMap) */
+class MapKey {
+    public var id:Int;
+    public function new(id:Int) { this.id = id; }
+}
+
+/** Enum keys: Map<Color, Int> compiles to haxe.ds.EnumValueMap (no native hashtable) */
+enum Color {
+    Red;
+    Green;
+    Blue;
+}
+
 class MapTest {
+    static var objectKeys = [new MapKey(0), new MapKey(1), new MapKey(2)];
+
     public static function createIntMap():Map<Int, String> {
         var map = new Map<Int, String>();
         map.set(1, "one");
@@ -43,6 +58,60 @@ class MapTest {
         return map.get(key);
     }
 
+    /** Sum of all values - lets C check that Haxe sees its writes */
+    public static function sumStringMap(map:Map<String, Int>):Int {
+        var sum = 0;
+        for (v in map) sum += v;
+        return sum;
+    }
+
+    /** Haxe-side read of a value C stored: calls a String method on it */
+    public static function intMapValueLength(map:Map<Int, String>, key:Int):Int {
+        var v = map.get(key);
+        return v == null ? -1 : v.length;
+    }
+
+    public static function sumIntMap(map:Map<Int, Int>):Int {
+        var sum = 0;
+        for (v in map) sum += v;
+        return sum;
+    }
+
+    /** Shared key objects, so C and Haxe use the same identities */
+    public static function objectKey(i:Int):MapKey {
+        return objectKeys[i];
+    }
+
+    public static function createObjectMap():Map<MapKey, Int> {
+        var map = new Map<MapKey, Int>();
+        map.set(objectKeys[0], 100);
+        map.set(objectKeys[1], 200);
+        return map;
+    }
+
+    public static function getObjectMapValue(map:Map<MapKey, Int>, key:MapKey):Int {
+        return map.exists(key) ? map.get(key) : -1;
+    }
+
+    public static function colorKey(i:Int):Color {
+        return switch (i) {
+            case 0: Red;
+            case 1: Green;
+            default: Blue;
+        }
+    }
+
+    public static function createEnumMap():Map<Color, Int> {
+        var map = new Map<Color, Int>();
+        map.set(Red, 1);
+        map.set(Green, 2);
+        return map;
+    }
+
+    public static function getEnumMapValue(map:Map<Color, Int>, key:Color):Int {
+        return map.exists(key) ? map.get(key) : -1;
+    }
+
     public static function main() {
         trace("MapTest initialized");
         // Call exists to ensure it's included
@@ -53,5 +122,15 @@ class MapTest {
         var strMap = createStringMap();
         trace("StringMap exists('a'): " + strMap.exists("a"));
         trace("StringMap get('b'): " + strMap.get("b"));
+
+        // Keep the EnumValueMap methods C reaches reflectively (DCE)
+        var enumMap = createEnumMap();
+        enumMap.set(Blue, 3);
+        trace("EnumMap get(Blue): " + enumMap.get(Blue) + ", exists(Red): " + enumMap.exists(Red));
+        enumMap.remove(Blue);
+        enumMap.clear();
+
+        var objectMap = createObjectMap();
+        trace("ObjectMap get(key 0): " + objectMap.get(objectKey(0)));
     }
 }
@@ -0,0 +1,195 @@
+/**
+ * Callback Dispatch Benchmark
+ *
+ * Measures the cost of a Haxe -> C callback invocation through a wrapper
+ * registered with hlffi_register_callback(), for a 0-argument and a
+ * 6-argument callback (onCollision(a, b, x, y, impulse, solid)).
+ *
+ * The dispatch path builds argv on the C stack, so the per-call cost is the
+ * Haxe dynamic call plus one hlffi_native_func invocation, with no heap
+ * allocation on the C side regardless of arity. Callbacks that return NULL
+ * also avoid allocating a result value.
+ *
+ * Benchmark 2 compares the same (Int, Float, Bool)->Float hook registered
+ * with hlffi_register_callback() (Haxe boxes every argument into a Dynamic)
+ * and with hlffi_register_callback_typed() (arguments passed unboxed).
+ *
+ * Benchmark 3 registers BINDINGS callbacks (a modding layer's native API)
+ * and looks each one up by name with hlffi_get_callback().
+ *
+ * Expected results:
+ * - per-call cost roughly flat across arities (no malloc per argument)
+ * - typed: no per-call boxing allocation on the Haxe side
+ * - registry: registration and lookup cost independent of the binding count
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CALLS 1000000
+#define BINDINGS 1500
+
+/* High-resolution timer */
+static double get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static long long notify_count = 0;
+static double impulse_sum = 0.0;
+
+static hlffi_value* on_notify(hlffi_vm* vm, int argc, hlffi_value** argv) {
+    (void)vm; (void)argc; (void)argv;
+    notify_count++;
+    return NULL;
+}
+
+static hlffi_value* on_collision(hlffi_vm* vm, int argc, hlffi_value** argv) {
+    (void)vm; (void)argc;
+    int a = hlffi_value_as_int(argv[0], 0);
+    int b = hlffi_value_as_int(argv[1], 0);
+    double x = hlffi_value_as_float(argv[2], 0.0);
+    double y = hlffi_value_as_float(argv[3], 0.0);
+    double impulse = hlffi_value_as_float(argv[4], 0.0);
+    bool solid = hlffi_value_as_bool(argv[5], false);
+    if (solid && b == a + 1) impulse_sum += impulse + x - y;
+    return NULL;
+}
+
+static hlffi_value* on_impact(hlffi_vm* vm, int argc, hlffi_value** argv) {
+    (void)argc;
+    int id = hlffi_value_as_int(argv[0], 0);
+    double force = hlffi_value_as_float(argv[1], 0.0);
+    bool solid = hlffi_value_as_bool(argv[2], false);
+    (void)id; (void)force; (void)solid;
+    return NULL;  /* 0.0 to Haxe, no allocation */
+}
+
+static bool install(hlffi_vm* vm, const char* name, hlffi_native_func fn, int nargs) {
+    if (!hlffi_register_callback(vm, name, fn, nargs)) return false;
+    hlffi_value* cb = hlffi_get_callback(vm, name);
+    return cb && hlffi_set_static_field(vm, "Callbacks", name, cb) == HLFFI_OK;
+}
+
+static bool install_typed(hlffi_vm* vm, const char* name, hlffi_native_func fn,
+                          int nargs, const hlffi_arg_type* args, hlffi_arg_type ret) {
+    if (!hlffi_register_callback_typed(vm, name, fn, nargs, args, ret)) return false;
+    hlffi_value* cb = hlffi_get_callback(vm, name);
+    return cb && hlffi_set_static_field(vm, "Callbacks", name, cb) == HLFFI_OK;
+}
+
+static double fire(hlffi_vm* vm, const char* method, int n) {
+    hlffi_value* count = hlffi_value_int(vm, n);
+    double start = get_time_ns();
+    hlffi_value* result = hlffi_call_static(vm, "Callbacks", method, 1, &count);
+    double ns = (get_time_ns() - start) / n;
+    hlffi_value_free(result);
+    hlffi_value_free(count);
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <callbacks.hl>\n", argv[0]);
+        return 1;
+    }
+
+    printf("=== Callback Dispatch Benchmark ===\n\n");
+
+    hlffi_vm* vm = hlffi_create();
+    if (!vm || hlffi_init(vm, 0, NULL) != HLFFI_OK) {
+        fprintf(stderr, "Failed to initialize VM\n");
+        return 1;
+    }
+
+    if (hlffi_load_file(vm, argv[1]) != HLFFI_OK) {
+        fprintf(stderr, "Failed to load bytecode: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    if (hlffi_call_entry(vm) != HLFFI_OK) {
+        fprintf(stderr, "Failed to call entry point: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    hlffi_arg_type impact_args[] = {HLFFI_ARG_INT, HLFFI_ARG_FLOAT, HLFFI_ARG_BOOL};
+    if (!install(vm, "onNotify", on_notify, 0) ||
+        !install(vm, "onCollision", on_collision, 6) ||
+        !install(vm, "onImpactDynamic", on_impact, 3) ||
+        !install_typed(vm, "onImpact", on_impact, 3, impact_args, HLFFI_ARG_FLOAT)) {
+        fprintf(stderr, "Failed to register callbacks: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    /* ========== Arity 0 vs 6 ========== */
+    printf("Benchmark 1: %d Haxe -> C invocations\n", CALLS);
+
+    /* Warm up */
+    fire(vm, "fireNotifies", 1000);
+    fire(vm, "fireCollisions", 1000);
+
+    double notify_ns = fire(vm, "fireNotifies", CALLS);
+    double collision_ns = fire(vm, "fireCollisions", CALLS);
+
+    printf("  0 args (onNotify):    %.2f ns/call\n", notify_ns);
+    printf("  6 args (onCollision): %.2f ns/call\n", collision_ns);
+    printf("  Calls seen: %lld notify, impulse sum %.1f\n\n", notify_count, impulse_sum);
+
+    /* ========== Dynamic vs typed ========== */
+    printf("Benchmark 2: (Int, Float, Bool)->Float hook, %d invocations\n", CALLS);
+
+    fire(vm, "fireImpactsDynamic", 1000);
+    fire(vm, "fireImpacts", 1000);
+
+    double dynamic_ns = fire(vm, "fireImpactsDynamic", CALLS);
+    double typed_ns = fire(vm, "fireImpacts", CALLS);
+
+    printf("  Dynamic (boxed args): %.2f ns/call\n", dynamic_ns);
+    printf("  Typed (raw args):     %.2f ns/call\n", typed_ns);
+    printf("  Speedup: %.1fx\n\n", dynamic_ns / typed_ns);
+
+    /* ========== Registry size ========== */
+    printf("Benchmark 3: register and look up %d named bindings\n", BINDINGS);
+
+    static char names[BINDINGS][32];
+    for (int i = 0; i < BINDINGS; i++) {
+        snprintf(names[i], sizeof(names[i]), "mod_binding_%d", i);
+    }
+
+    int registered = 0;
+    double start = get_time_ns();
+    for (int i = 0; i < BINDINGS; i++) {
+        if (hlffi_register_callback(vm, names[i], on_notify, 0)) registered++;
+    }
+    double register_ns = (get_time_ns() - start) / BINDINGS;
+
+    int found = 0;
+    start = get_time_ns();
+    for (int i = 0; i < BINDINGS; i++) {
+        hlffi_value* cb = hlffi_get_callback(vm, names[i]);
+        if (cb) {
+            found++;
+            hlffi_value_free(cb);
+        }
+    }
+    double lookup_ns = (get_time_ns() - start) / BINDINGS;
+
+    printf("  Registered: %d/%d (%.2f ns each)\n", registered, BINDINGS, register_ns);
+    printf("  Lookup:     %d/%d (%.2f ns each)\n\n", found, BINDINGS, lookup_ns);
+
+    printf("=== Summary ===\n");
+    printf("Callback arguments are passed as stack-resident views: dispatch cost\n");
+    printf("does not grow with malloc traffic as the arity increases, and typed\n");
+    printf("callbacks receive Int/Float/Bool without boxing. The registry is\n");
+    printf("hashed and unbounded, so large binding sets stay O(1) per lookup.\n");
+
+    hlffi_destroy(vm);
+    return 0;
+}
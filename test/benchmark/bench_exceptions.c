@@ -0,0 +1,105 @@
+/**
+ * Exception Capture Benchmark
+ *
+ * Measures hlffi_try_call_static() on a Haxe method that always throws,
+ * with and without reading the exception text.
+ *
+ * Capturing an exception only roots the exception object and copies the
+ * stack addresses recorded by the runtime; the message (hl_to_string) and the
+ * symbolicated stack trace are produced on the first
+ * hlffi_get_exception_message/_stack call.
+ *
+ * Expected results:
+ * - capture only:    cost of the throw itself
+ * - message:         + one toString/UTF-8 conversion per exception
+ * - message + stack: + symbol resolution of every frame
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ITERATIONS 100000
+#define STACK_ITERATIONS 1000
+
+/* High-resolution timer */
+static double get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <exceptions.hl>\n", argv[0]);
+        return 1;
+    }
+
+    printf("=== Exception Capture Benchmark ===\n\n");
+
+    hlffi_vm* vm = hlffi_create();
+    if (!vm || hlffi_init(vm, 0, NULL) != HLFFI_OK) {
+        fprintf(stderr, "Failed to initialize VM\n");
+        return 1;
+    }
+
+    if (hlffi_load_file(vm, argv[1]) != HLFFI_OK) {
+        fprintf(stderr, "Failed to load bytecode: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    if (hlffi_call_entry(vm) != HLFFI_OK) {
+        fprintf(stderr, "Failed to call entry point: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    hlffi_value* result = NULL;
+    int thrown = 0;
+
+    /* ========== Throw without reading the text ========== */
+    printf("Benchmark 1: Exceptions.nestedThrow() via hlffi_try_call_static\n");
+
+    double start = get_time_ns();
+    for (int i = 0; i < ITERATIONS; i++) {
+        if (hlffi_try_call_static(vm, "Exceptions", "nestedThrow", 0, NULL, &result, NULL) == HLFFI_CALL_EXCEPTION) {
+            thrown++;
+        }
+    }
+    double capture_ns = (get_time_ns() - start) / ITERATIONS;
+
+    size_t chars = 0;
+    start = get_time_ns();
+    for (int i = 0; i < ITERATIONS; i++) {
+        const char* error = NULL;
+        hlffi_try_call_static(vm, "Exceptions", "nestedThrow", 0, NULL, &result, &error);
+        if (error) chars += error[0] != '\0';
+    }
+    double message_ns = (get_time_ns() - start) / ITERATIONS;
+
+    start = get_time_ns();
+    for (int i = 0; i < STACK_ITERATIONS; i++) {
+        hlffi_try_call_static(vm, "Exceptions", "nestedThrow", 0, NULL, &result, NULL);
+        const char* message = hlffi_get_exception_message(vm);
+        const char* stack = hlffi_get_exception_stack(vm);
+        if (message && stack) chars += stack[0] != '\0';
+    }
+    double stack_ns = (get_time_ns() - start) / STACK_ITERATIONS;
+
+    printf("  Capture only:    %.2f ns/exception (%d thrown)\n", capture_ns, thrown);
+    printf("  + message:       %.2f ns/exception\n", message_ns);
+    printf("  + message/stack: %.2f ns/exception\n\n", stack_ns);
+
+    printf("Last exception: %s\n", hlffi_get_exception_message(vm));
+    printf("%s\n", hlffi_get_exception_stack(vm));
+    (void)chars;
+
+    printf("=== Summary ===\n");
+    printf("Exception text is only built when it is read, so exception-driven\n");
+    printf("control flow pays for the throw, not for formatting.\n");
+
+    hlffi_destroy(vm);
+    return 0;
+}
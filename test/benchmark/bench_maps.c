@@ -0,0 +1,268 @@
+/**
+ * Map Access Benchmark
+ *
+ * Compares Map<String, Int> access through reflective method calls
+ * (hlffi_call_method(map, "set"/"get", ...), the strategy hlffi_map_* used
+ * before the native path) against the native hashtable path:
+ * - hlffi_map_set/hlffi_map_get with hlffi_value keys
+ * - hlffi_map_str_set_int/hlffi_map_str_get_int with C string keys
+ *
+ * Expected results:
+ * - Reflective: ~300ns+ per operation (method lookup, argument array, result wrapper)
+ * - Native:     hashtable cost plus key conversion, no per-call lookup
+ * - Typed:      no hlffi_value wrappers at all
+ *
+ * Benchmark 3 snapshots the map from C: Haxe value iterator driven through
+ * hasNext()/next() versus hlffi_map_foreach and hlffi_map_export.
+ *
+ * Benchmark 4 loads a fresh table per pass with one hlffi_map_str_set_int
+ * per key versus a single hlffi_map_set_many.
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <hl.h>
+
+#define KEYS 10000
+#define PASSES 10
+
+/* High-resolution timer */
+static double get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static char key_names[KEYS][24];
+
+static bool sum_entry(hlffi_value* key, hlffi_value* value, void* userdata) {
+    (void)key;
+    *(long*)userdata += hlffi_value_as_int(value, 0);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <map_test.hl>\n", argv[0]);
+        return 1;
+    }
+
+    printf("=== Map Access Benchmark: native hashtable vs reflective calls ===\n\n");
+
+    hlffi_vm* vm = hlffi_create();
+    if (!vm || hlffi_init(vm, 0, NULL) != HLFFI_OK) {
+        fprintf(stderr, "Failed to initialize VM\n");
+        return 1;
+    }
+
+    if (hlffi_load_file(vm, argv[1]) != HLFFI_OK || hlffi_call_entry(vm) != HLFFI_OK) {
+        fprintf(stderr, "Failed to load bytecode: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    for (int i = 0; i < KEYS; i++) {
+        snprintf(key_names[i], sizeof(key_names[i]), "item.%d", i);
+    }
+
+    hlffi_value* reflective = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+    hlffi_value* native = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+    hlffi_value* typed = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+    if (!reflective || !native || !typed) {
+        fprintf(stderr, "Failed to create maps: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    printf("Map<String, Int>: %d keys, %d passes\n\n", KEYS, PASSES);
+
+    /* ========== Insert ========== */
+    printf("Benchmark 1: set\n");
+
+    double start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (int i = 0; i < KEYS; i++) {
+            hlffi_value* args[2] = { hlffi_value_string(vm, key_names[i]), hlffi_value_int(vm, i) };
+            hlffi_value* result = hlffi_call_method(reflective, "set", 2, args);
+            hlffi_value_free(result);
+            hlffi_value_free(args[0]);
+            hlffi_value_free(args[1]);
+        }
+    }
+    double reflective_set_ns = (get_time_ns() - start) / ((double)PASSES * KEYS);
+
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (int i = 0; i < KEYS; i++) {
+            hlffi_value* key = hlffi_value_string(vm, key_names[i]);
+            hlffi_value* val = hlffi_value_int(vm, i);
+            hlffi_map_set(vm, native, key, val);
+            hlffi_value_free(key);
+            hlffi_value_free(val);
+        }
+    }
+    double native_set_ns = (get_time_ns() - start) / ((double)PASSES * KEYS);
+
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (int i = 0; i < KEYS; i++) {
+            hlffi_map_str_set_int(vm, typed, key_names[i], i);
+        }
+    }
+    double typed_set_ns = (get_time_ns() - start) / ((double)PASSES * KEYS);
+
+    printf("  Reflective map.set:     %.2f ns/op\n", reflective_set_ns);
+    printf("  hlffi_map_set:          %.2f ns/op\n", native_set_ns);
+    printf("  hlffi_map_str_set_int:  %.2f ns/op\n", typed_set_ns);
+    printf("  Sizes: %d / %d / %d\n\n",
+           hlffi_map_size(reflective), hlffi_map_size(native), hlffi_map_size(typed));
+
+    /* ========== Lookup ========== */
+    printf("Benchmark 2: get\n");
+
+    long sum_reflective = 0;
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (int i = 0; i < KEYS; i++) {
+            hlffi_value* key = hlffi_value_string(vm, key_names[i]);
+            hlffi_value* result = hlffi_call_method(reflective, "get", 1, &key);
+            sum_reflective += hlffi_value_as_int(result, 0);
+            hlffi_value_free(result);
+            hlffi_value_free(key);
+        }
+    }
+    double reflective_get_ns = (get_time_ns() - start) / ((double)PASSES * KEYS);
+
+    long sum_native = 0;
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (int i = 0; i < KEYS; i++) {
+            hlffi_value* key = hlffi_value_string(vm, key_names[i]);
+            hlffi_value* result = hlffi_map_get(vm, native, key);
+            sum_native += hlffi_value_as_int(result, 0);
+            hlffi_value_free(result);
+            hlffi_value_free(key);
+        }
+    }
+    double native_get_ns = (get_time_ns() - start) / ((double)PASSES * KEYS);
+
+    long sum_typed = 0;
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (int i = 0; i < KEYS; i++) {
+            sum_typed += hlffi_map_str_get_int(vm, typed, key_names[i], 0);
+        }
+    }
+    double typed_get_ns = (get_time_ns() - start) / ((double)PASSES * KEYS);
+
+    printf("  Reflective map.get:     %.2f ns/op\n", reflective_get_ns);
+    printf("  hlffi_map_get:          %.2f ns/op\n", native_get_ns);
+    printf("  hlffi_map_str_get_int:  %.2f ns/op\n", typed_get_ns);
+    printf("  Speedup (typed):        %.1fx (checksums %ld / %ld / %ld)\n\n",
+           reflective_get_ns / typed_get_ns, sum_reflective, sum_native, sum_typed);
+
+    /* ========== Snapshot ========== */
+    printf("Benchmark 3: read all %d entries\n", KEYS);
+
+    long sum_iter = 0;
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        hlffi_value* it = hlffi_map_values(vm, typed);
+        for (;;) {
+            hlffi_value* has_next = hlffi_call_method(it, "hasNext", 0, NULL);
+            bool more = hlffi_value_as_bool(has_next, false);
+            hlffi_value_free(has_next);
+            if (!more) break;
+            hlffi_value* v = hlffi_call_method(it, "next", 0, NULL);
+            sum_iter += hlffi_value_as_int(v, 0);
+            hlffi_value_free(v);
+        }
+        hlffi_value_free(it);
+    }
+    double iter_ms = (get_time_ns() - start) / PASSES / 1e6;
+
+    long sum_foreach = 0;
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        hlffi_map_foreach(vm, typed, sum_entry, &sum_foreach);
+    }
+    double foreach_ms = (get_time_ns() - start) / PASSES / 1e6;
+
+    char** names = (char**)malloc(KEYS * sizeof(char*));
+    int32_t* counts = (int32_t*)malloc(KEYS * sizeof(int32_t));
+    int exported = 0;
+    start = get_time_ns();
+    for (int p = 0; p < PASSES; p++) {
+        exported = hlffi_map_export(vm, typed, HLFFI_TYPE_VOID, NULL, HLFFI_TYPE_I32, counts, KEYS);
+    }
+    double export_ms = (get_time_ns() - start) / PASSES / 1e6;
+
+    start = get_time_ns();
+    int exported_keys = hlffi_map_export(vm, typed, HLFFI_TYPE_BYTES, names, HLFFI_TYPE_I32, counts, KEYS);
+    double export_keys_ms = (get_time_ns() - start) / 1e6;
+    for (int i = 0; i < exported_keys; i++) free(names[i]);
+    free(names);
+    free(counts);
+
+    printf("  Iterator hasNext/next:  %.3f ms\n", iter_ms);
+    printf("  hlffi_map_foreach:      %.3f ms\n", foreach_ms);
+    printf("  hlffi_map_export:       %.3f ms (%d values)\n", export_ms, exported);
+    printf("  ... with UTF-8 keys:    %.3f ms (%d entries)\n", export_keys_ms, exported_keys);
+    printf("  Speedup (export):       %.1fx (checksums %ld / %ld)\n\n",
+           iter_ms / export_ms, sum_iter, sum_foreach);
+
+    /* ========== Bulk load ========== */
+    printf("Benchmark 4: load %d entries into an empty map\n", KEYS);
+
+    const char** key_ptrs = (const char**)malloc(KEYS * sizeof(char*));
+    int32_t* load_values = (int32_t*)malloc(KEYS * sizeof(int32_t));
+    for (int i = 0; i < KEYS; i++) {
+        key_ptrs[i] = key_names[i];
+        load_values[i] = i;
+    }
+
+    double one_by_one_ns = 0.0;
+    double bulk_ns = 0.0;
+    int loaded = 0;
+    for (int p = 0; p < PASSES; p++) {
+        hlffi_value* table = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+        start = get_time_ns();
+        for (int i = 0; i < KEYS; i++) {
+            hlffi_map_str_set_int(vm, table, key_names[i], load_values[i]);
+        }
+        one_by_one_ns += get_time_ns() - start;
+        hlffi_value_free(table);
+
+        table = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+        start = get_time_ns();
+        hlffi_map_set_many(vm, table, HLFFI_TYPE_BYTES, key_ptrs, HLFFI_TYPE_I32, load_values, KEYS);
+        bulk_ns += get_time_ns() - start;
+        loaded = hlffi_map_size(table);
+        hlffi_value_free(table);
+    }
+    free(key_ptrs);
+    free(load_values);
+
+    printf("  hlffi_map_str_set_int x N: %.2f ns/entry\n", one_by_one_ns / ((double)PASSES * KEYS));
+    printf("  hlffi_map_set_many:        %.2f ns/entry (%d loaded)\n",
+           bulk_ns / ((double)PASSES * KEYS), loaded);
+    printf("  vs reflective map.set:     %.1fx faster\n\n",
+           reflective_set_ns / (bulk_ns / ((double)PASSES * KEYS)));
+
+    /* Haxe iterates the map filled from C */
+    hlffi_value* result = hlffi_call_static(vm, "MapTest", "sumStringMap", 1, &typed);
+    printf("Haxe sees the C writes: sum = %d\n\n", hlffi_value_as_int(result, -1));
+    hlffi_value_free(result);
+
+    printf("=== Summary ===\n");
+    printf("Native map access skips method lookup and argument boxing;\n");
+    printf("typed variants also skip hlffi_value wrappers for keys and values.\n");
+
+    hlffi_value_free(typed);
+    hlffi_value_free(native);
+    hlffi_value_free(reflective);
+    hlffi_destroy(vm);
+    return 0;
+}
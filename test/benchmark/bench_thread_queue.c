@@ -0,0 +1,186 @@
+/**
+ * THREADED Mode Message Queue Benchmark
+ *
+ * Measures the VM thread message queue under concurrent producers:
+ * - Async throughput: N producer threads posting no-op work
+ * - Sync round trip: one caller issuing hlffi_thread_call_sync() back to back
+ * - Concurrent sync callers: each waits on its own completion and checks
+ *   that it got its own result back (hlffi_thread_call_sync_result)
+ * - Batched submission: BATCH_SIZE calls as N sync round trips vs one
+ *   hlffi_thread_call_batch() (one enqueue, one wait)
+ *
+ * The queue is lock-free for producers; the VM thread drains all pending
+ * messages per wakeup, so async throughput should scale with producers
+ * instead of serializing on a mutex.
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+#define MESSAGES_PER_PRODUCER 100000
+#define SYNC_ITERATIONS 10000
+#define MAX_PRODUCERS 16
+#define BATCH_SIZE 256
+#define BATCH_FRAMES 1000
+
+/* High-resolution timer */
+static double get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static hlffi_vm* g_vm;
+static long g_executed;  /* Only touched by the VM thread */
+
+static void noop_work(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    (void)userdata;
+    g_executed++;
+}
+
+static void* echo_work(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    g_executed++;
+    return userdata;
+}
+
+static int g_wrong_results;  /* Updated atomically by sync callers */
+
+static void* sync_caller_main(void* arg) {
+    intptr_t id = (intptr_t)arg;
+    for (int i = 0; i < SYNC_ITERATIONS; i++) {
+        void* token = (void*)(id * SYNC_ITERATIONS + i);
+        void* result = NULL;
+        hlffi_thread_call_sync_result(g_vm, echo_work, token, &result);
+        if (result != token) {
+            __atomic_fetch_add(&g_wrong_results, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return NULL;
+}
+
+static void* producer_main(void* arg) {
+    (void)arg;
+    for (int i = 0; i < MESSAGES_PER_PRODUCER; i++) {
+        hlffi_thread_call_async(g_vm, noop_work, NULL, NULL);
+    }
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <module.hl>\n", argv[0]);
+        return 1;
+    }
+
+    printf("=== THREADED Mode Message Queue Benchmark ===\n\n");
+
+    g_vm = hlffi_create();
+    if (!g_vm || hlffi_init(g_vm, 0, NULL) != HLFFI_OK) {
+        fprintf(stderr, "Failed to initialize VM\n");
+        return 1;
+    }
+    hlffi_set_integration_mode(g_vm, HLFFI_MODE_THREADED);
+
+    if (hlffi_load_file(g_vm, argv[1]) != HLFFI_OK) {
+        fprintf(stderr, "Failed to load bytecode: %s\n", hlffi_get_error(g_vm));
+        hlffi_destroy(g_vm);
+        return 1;
+    }
+
+    if (hlffi_thread_start(g_vm) != HLFFI_OK) {
+        fprintf(stderr, "Failed to start VM thread: %s\n", hlffi_get_error(g_vm));
+        hlffi_destroy(g_vm);
+        return 1;
+    }
+
+    /* Sync round trip */
+    double start = get_time_ns();
+    for (int i = 0; i < SYNC_ITERATIONS; i++) {
+        hlffi_thread_call_sync(g_vm, noop_work, NULL);
+    }
+    double sync_ns = (get_time_ns() - start) / SYNC_ITERATIONS;
+    printf("Sync round trip:  %.0f ns/call (%d calls)\n\n", sync_ns, SYNC_ITERATIONS);
+
+    /* Concurrent sync callers */
+    pthread_t callers[MAX_PRODUCERS];
+    const int ncallers = 8;
+    start = get_time_ns();
+    for (intptr_t i = 0; i < ncallers; i++) {
+        pthread_create(&callers[i], NULL, sync_caller_main, (void*)i);
+    }
+    for (int i = 0; i < ncallers; i++) {
+        pthread_join(callers[i], NULL);
+    }
+    double concurrent_ms = (get_time_ns() - start) / 1e6;
+    printf("Concurrent sync:  %d callers x %d calls in %.2f ms, %d wrong results\n\n",
+           ncallers, SYNC_ITERATIONS, concurrent_ms, g_wrong_results);
+
+    /* Batched submission: a "frame" of BATCH_SIZE small calls */
+    static hlffi_thread_call batch[BATCH_SIZE];
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        batch[i].func = echo_work;
+        batch[i].userdata = (void*)(intptr_t)i;
+    }
+
+    start = get_time_ns();
+    for (int f = 0; f < BATCH_FRAMES; f++) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            hlffi_thread_call_sync_result(g_vm, echo_work, batch[i].userdata, &batch[i].result);
+        }
+    }
+    double individual_us = (get_time_ns() - start) / BATCH_FRAMES / 1e3;
+
+    start = get_time_ns();
+    for (int f = 0; f < BATCH_FRAMES; f++) {
+        hlffi_thread_call_batch(g_vm, batch, BATCH_SIZE);
+    }
+    double batched_us = (get_time_ns() - start) / BATCH_FRAMES / 1e3;
+
+    int batch_ok = 1;
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        if (batch[i].result != batch[i].userdata) batch_ok = 0;
+    }
+    printf("Frame of %d calls: %.1f us as sync calls, %.1f us batched (%.1fx) %s\n\n",
+           BATCH_SIZE, individual_us, batched_us, individual_us / batched_us,
+           batch_ok ? "(OK)" : "(WRONG RESULTS)");
+
+    /* Async throughput with increasing producer counts */
+    printf("%-10s %14s %16s\n", "Producers", "Total (ms)", "Messages/sec");
+    printf("------------------------------------------\n");
+
+    for (int producers = 1; producers <= MAX_PRODUCERS; producers *= 2) {
+        pthread_t threads[MAX_PRODUCERS];
+
+        start = get_time_ns();
+        for (int i = 0; i < producers; i++) {
+            pthread_create(&threads[i], NULL, producer_main, NULL);
+        }
+        for (int i = 0; i < producers; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        /* Sync call completes after everything queued before it (FIFO) */
+        hlffi_thread_call_sync(g_vm, noop_work, NULL);
+        double total_ms = (get_time_ns() - start) / 1e6;
+
+        long messages = (long)producers * MESSAGES_PER_PRODUCER;
+        printf("%-10d %14.2f %16.0f\n", producers, total_ms, messages / (total_ms / 1000.0));
+    }
+
+    hlffi_thread_stop(g_vm);
+
+    long expected = SYNC_ITERATIONS + (long)ncallers * SYNC_ITERATIONS + 2L * BATCH_FRAMES * BATCH_SIZE;
+    for (int producers = 1; producers <= MAX_PRODUCERS; producers *= 2) {
+        expected += (long)producers * MESSAGES_PER_PRODUCER + 1;
+    }
+    printf("\nExecuted: %ld / %ld messages %s\n", g_executed, expected,
+           g_executed == expected ? "(OK)" : "(MISMATCH)");
+
+    hlffi_destroy(g_vm);
+    return (g_executed == expected && g_wrong_results == 0) ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+/**
+ * Type Lookup Benchmark
+ *
+ * Compares by-name type lookup cost against the number of types in the module.
+ *
+ * hlffi_find_type() (and hlffi_new / hlffi_call_static / hlffi_cache_static_method)
+ * resolve class names through a hash index built at load time. This benchmark
+ * measures it against a reference linear scan over all types - the strategy
+ * used before the index existed - at increasing positions in the type table,
+ * i.e. with an increasing number of types to walk before the match.
+ *
+ * Expected results:
+ * - Linear scan: grows with the number of types scanned (~20-50ns per type)
+ * - Indexed:     flat, independent of module size
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ITERATIONS 10000
+#define MAX_NAMES 65536
+
+/* High-resolution timer */
+static double get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* ========== Reference linear scan (old lookup strategy) ========== */
+
+typedef struct {
+    const char* target;
+    hlffi_type* found;
+} scan_ctx;
+
+static void scan_callback(hlffi_type* type, void* userdata) {
+    scan_ctx* ctx = (scan_ctx*)userdata;
+    if (ctx->found) return;
+
+    hlffi_type_kind kind = hlffi_type_get_kind(type);
+    if (kind != HLFFI_TYPE_OBJ && kind != HLFFI_TYPE_ENUM && kind != HLFFI_TYPE_ABSTRACT) return;
+
+    /* Name conversion per type, like the old scan did */
+    const char* name = hlffi_type_get_name(type);
+    if (name && strcmp(name, ctx->target) == 0) {
+        ctx->found = type;
+    }
+}
+
+static hlffi_type* linear_find_type(hlffi_vm* vm, const char* name) {
+    scan_ctx ctx = { name, NULL };
+    hlffi_list_types(vm, scan_callback, &ctx);
+    return ctx.found;
+}
+
+/* ========== Collect named types in table order ========== */
+
+typedef struct {
+    char* names[MAX_NAMES];
+    int count;
+    int total_types;
+} name_list;
+
+static void collect_callback(hlffi_type* type, void* userdata) {
+    name_list* list = (name_list*)userdata;
+    list->total_types++;
+
+    hlffi_type_kind kind = hlffi_type_get_kind(type);
+    if (kind != HLFFI_TYPE_OBJ && kind != HLFFI_TYPE_ENUM && kind != HLFFI_TYPE_ABSTRACT) return;
+    if (list->count >= MAX_NAMES) return;
+
+    const char* name = hlffi_type_get_name(type);
+    if (!name) return;
+
+    /* Skip duplicates so the scan position is that of the first match */
+    for (int i = 0; i < list->count; i++) {
+        if (strcmp(list->names[i], name) == 0) return;
+    }
+    list->names[list->count++] = strdup(name);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <module.hl>\n", argv[0]);
+        return 1;
+    }
+
+    printf("=== Type Lookup Benchmark: index vs linear scan ===\n\n");
+
+    hlffi_vm* vm = hlffi_create();
+    if (!vm || hlffi_init(vm, 0, NULL) != HLFFI_OK) {
+        fprintf(stderr, "Failed to initialize VM\n");
+        return 1;
+    }
+
+    double load_start = get_time_ns();
+    if (hlffi_load_file(vm, argv[1]) != HLFFI_OK) {
+        fprintf(stderr, "Failed to load bytecode: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+    double load_ms = (get_time_ns() - load_start) / 1e6;
+
+    static name_list names;
+    hlffi_list_types(vm, collect_callback, &names);
+
+    printf("Module:      %s\n", argv[1]);
+    printf("Types:       %d total, %d named (class/enum/abstract)\n", names.total_types, names.count);
+    printf("Load time:   %.2f ms (includes index build)\n", load_ms);
+    printf("Iterations:  %d per sample\n\n", ITERATIONS);
+
+    if (names.count == 0) {
+        fprintf(stderr, "No named types in module\n");
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    /* Sample names at increasing positions in the type table */
+    const double fractions[] = { 0.0, 0.1, 0.25, 0.5, 0.75, 1.0 };
+    const int nsamples = (int)(sizeof(fractions) / sizeof(fractions[0]));
+
+    printf("%-10s %-40s %14s %14s %10s\n", "Scanned", "Type", "Linear (ns)", "Indexed (ns)", "Speedup");
+    printf("---------------------------------------------------------------------------------------------\n");
+
+    for (int s = 0; s < nsamples; s++) {
+        int pos = (int)(fractions[s] * (names.count - 1));
+        const char* name = names.names[pos];
+
+        /* Sanity check: both strategies must agree */
+        hlffi_type* expected = linear_find_type(vm, name);
+        hlffi_type* actual = hlffi_find_type(vm, name);
+        if (expected != actual) {
+            fprintf(stderr, "MISMATCH for %s: linear=%p indexed=%p\n", name, (void*)expected, (void*)actual);
+            hlffi_destroy(vm);
+            return 1;
+        }
+
+        double start = get_time_ns();
+        for (int i = 0; i < ITERATIONS; i++) {
+            (void)linear_find_type(vm, name);
+        }
+        double linear_ns = (get_time_ns() - start) / ITERATIONS;
+
+        start = get_time_ns();
+        for (int i = 0; i < ITERATIONS; i++) {
+            (void)hlffi_find_type(vm, name);
+        }
+        double indexed_ns = (get_time_ns() - start) / ITERATIONS;
+
+        printf("%-10d %-40.40s %14.2f %14.2f %9.1fx\n",
+               pos + 1, name, linear_ns, indexed_ns, linear_ns / indexed_ns);
+    }
+
+    /* Miss path: unknown name walks every type in the linear scan */
+    const char* missing = "does.not.Exist";
+    double start = get_time_ns();
+    for (int i = 0; i < ITERATIONS; i++) {
+        (void)linear_find_type(vm, missing);
+    }
+    double linear_ns = (get_time_ns() - start) / ITERATIONS;
+
+    start = get_time_ns();
+    for (int i = 0; i < ITERATIONS; i++) {
+        (void)hlffi_find_type(vm, missing);
+    }
+    double indexed_ns = (get_time_ns() - start) / ITERATIONS;
+
+    printf("%-10s %-40s %14.2f %14.2f %9.1fx\n",
+           "miss", missing, linear_ns, indexed_ns, linear_ns / indexed_ns);
+
+    printf("\n=== Summary ===\n");
+    printf("Linear scan cost grows with the number of types walked;\n");
+    printf("indexed lookup cost stays constant regardless of module size.\n");
+
+    for (int i = 0; i < names.count; i++) {
+        free(names.names[i]);
+    }
+    hlffi_destroy(vm);
+
+    return 0;
+}
@@ -247,6 +247,175 @@ int main(int argc, char** argv) {
         hlffi_value_free(arr);
     }
 
+    /* Test 7a: push_n on Array<Int> past capacity */
+    {
+        hlffi_value* arr = hlffi_array_new(vm, &hlt_i32, 2);
+        int32_t values[100];
+        for (int i = 0; i < 100; i++) values[i] = i + 1;
+
+        bool ok = hlffi_array_push_n(vm, arr, values, 100) && hlffi_array_length(arr) == 102;
+
+        int32_t out[102];
+        ok = ok && hlffi_array_export(vm, arr, HLFFI_TYPE_I32, out, 102) == 102;
+        for (int i = 0; ok && i < 100; i++) {
+            ok = out[2 + i] == i + 1;
+        }
+
+        hlffi_value* args[] = {arr};
+        hlffi_value* sum = hlffi_call_static(vm, "Arrays", "sumIntArray", 1, args);
+        ok = ok && hlffi_value_as_int(sum, -1) == 5050;   /* 0 + 0 + 1..100 */
+        hlffi_value_free(sum);
+
+        if (ok) {
+            TEST_PASS("push_n on Array<Int> grows past capacity, values intact");
+        } else {
+            TEST_FAIL("push_n on Array<Int> grows past capacity, values intact");
+        }
+        hlffi_value_free(arr);
+    }
+
+    /* Test 7b: push_n on ArrayObj past capacity */
+    {
+        hlffi_value* arr = hlffi_array_new(vm, &hlt_dyn, 1);
+        hlffi_value* items[10];
+        for (int i = 0; i < 10; i++) items[i] = hlffi_value_int(vm, i * 7);
+
+        bool ok = hlffi_array_push_n(vm, arr, items, 10) && hlffi_array_length(arr) == 11;
+        for (int i = 0; ok && i < 10; i++) {
+            hlffi_value* elem = hlffi_array_get(vm, arr, 1 + i);
+            ok = hlffi_value_as_int(elem, -1) == i * 7;
+            hlffi_value_free(elem);
+        }
+        hlffi_value* out_of_range = hlffi_array_get(vm, arr, 11);
+        ok = ok && out_of_range == NULL;
+
+        for (int i = 0; i < 10; i++) hlffi_value_free(items[i]);
+
+        if (ok) {
+            TEST_PASS("push_n on Array<Dynamic> (ArrayObj) grows past capacity");
+        } else {
+            TEST_FAIL("push_n on Array<Dynamic> (ArrayObj) grows past capacity");
+        }
+        hlffi_value_free(arr);
+    }
+
+    /* Test 7c: pinned view - reserve, resize, length vs capacity */
+    {
+        hlffi_value* arr = hlffi_array_new(vm, &hlt_i32, 3);
+        hlffi_array_view v;
+        bool ok = hlffi_array_view_pin(vm, arr, &v) && v.type == HLFFI_TYPE_I32 &&
+                  v.length == 3 && v.capacity >= v.length;
+
+        if (ok) {
+            v.i32[0] = 11; v.i32[1] = 22; v.i32[2] = 33;
+
+            ok = hlffi_array_view_reserve(vm, &v, 64) && v.capacity >= 64 && v.length == 3 &&
+                 v.i32[0] == 11 && v.i32[2] == 33;
+
+            /* Within capacity: no reallocation, new elements are zero */
+            int32_t* before = v.i32;
+            ok = ok && hlffi_array_view_resize(vm, &v, 10) && v.length == 10 && v.i32 == before &&
+                 v.i32[9] == 0 && hlffi_array_length(arr) == 10;
+
+            /* Beyond capacity: grows, keeps contents */
+            ok = ok && hlffi_array_view_resize(vm, &v, v.capacity + 1) &&
+                 v.capacity >= v.length && v.i32[1] == 22;
+
+            /* Shrink keeps capacity */
+            int capacity = v.capacity;
+            ok = ok && hlffi_array_view_resize(vm, &v, 2) && v.length == 2 && v.capacity == capacity;
+        }
+        hlffi_array_view_release(&v);
+
+        if (ok) {
+            TEST_PASS("Array view reserve/resize: length vs capacity");
+        } else {
+            TEST_FAIL("Array view reserve/resize: length vs capacity");
+        }
+        hlffi_value_free(arr);
+    }
+
+    /* Test 7d: view refreshed after Haxe pushes */
+    {
+        hlffi_value* arr = hlffi_array_new(vm, &hlt_i32, 2);
+        hlffi_array_view v;
+        bool ok = hlffi_array_view_pin(vm, arr, &v);
+
+        if (ok) {
+            v.i32[0] = 5; v.i32[1] = 6;
+
+            /* Enough pushes to force Haxe to reallocate the buffer */
+            hlffi_value* count = hlffi_value_int(vm, 50);
+            hlffi_value* args[] = {arr, count};
+            hlffi_value_free(hlffi_call_static(vm, "Arrays", "pushValues", 2, args));
+            hlffi_value_free(count);
+
+            ok = hlffi_array_view_refresh(&v) && v.length == 52 && v.capacity >= 52 &&
+                 v.i32[0] == 5 && v.i32[1] == 6 && v.i32[2] == 1000 && v.i32[51] == 1049;
+        }
+        hlffi_array_view_release(&v);
+
+        if (ok) {
+            TEST_PASS("Array view refresh after Haxe push");
+        } else {
+            TEST_FAIL("Array view refresh after Haxe push");
+        }
+        hlffi_value_free(arr);
+    }
+
+    /* Test 7e: import into Array<Bool> / Array<Single>, truncated export */
+    {
+        hlffi_value* bools = hlffi_array_new(vm, &hlt_bool, 0);
+        hlffi_value* singles = hlffi_array_new(vm, &hlt_f32, 0);
+        static const bool flags[] = {true, false, true, true, false};
+        static const float floats[] = {0.5f, 1.5f, 2.0f};
+
+        bool ok = hlffi_array_import(vm, bools, HLFFI_TYPE_BOOL, flags, 5) &&
+                  hlffi_array_import(vm, singles, HLFFI_TYPE_F32, floats, 3) &&
+                  hlffi_array_length(bools) == 5 && hlffi_array_length(singles) == 3;
+
+        hlffi_value* bargs[] = {bools};
+        hlffi_value* true_count = hlffi_call_static(vm, "Arrays", "countTrue", 1, bargs);
+        ok = ok && hlffi_value_as_int(true_count, -1) == 3;
+        hlffi_value_free(true_count);
+
+        hlffi_value* sargs[] = {singles};
+        hlffi_value* sum = hlffi_call_static(vm, "Arrays", "sumSingleArray", 1, sargs);
+        ok = ok && hlffi_value_as_float(sum, -1.0) == 4.0;
+        hlffi_value_free(sum);
+
+        /* Wrong buffer type is rejected */
+        ok = ok && !hlffi_array_import(vm, singles, HLFFI_TYPE_F64, floats, 1);
+
+        /* Export truncated by max_count: ArrayBytes and raw varray */
+        bool out[5] = {false};
+        ok = ok && hlffi_array_export(vm, bools, HLFFI_TYPE_BOOL, NULL, 0) == 5 &&
+             hlffi_array_export(vm, bools, HLFFI_TYPE_BOOL, out, 2) == 2 &&
+             out[0] && !out[1] && !out[2];
+
+        hlffi_value* native = hlffi_native_array_new(vm, &hlt_i32, 5);
+        int32_t* data = (int32_t*)hlffi_native_array_get_ptr(native);
+        for (int i = 0; data && i < 5; i++) data[i] = i * i;
+        int32_t nout[5] = {-1, -1, -1, -1, -1};
+        ok = ok && data && hlffi_array_export(vm, native, HLFFI_TYPE_I32, nout, 3) == 3 &&
+             nout[2] == 4 && nout[3] == -1;
+
+        /* Raw varray import: fixed size */
+        static const int32_t fill[] = {9, 8};
+        ok = ok && hlffi_array_import(vm, native, HLFFI_TYPE_I32, fill, 2) &&
+             data[0] == 9 && data[1] == 8 && data[2] == 4 &&
+             !hlffi_array_import(vm, native, HLFFI_TYPE_I32, nout, 6);
+
+        if (ok) {
+            TEST_PASS("Array import (Bool/Single) and export truncated by max_count");
+        } else {
+            TEST_FAIL("Array import (Bool/Single) and export truncated by max_count");
+        }
+        hlffi_value_free(native);
+        hlffi_value_free(singles);
+        hlffi_value_free(bools);
+    }
+
     /* Test 8: Bounds checking */
     {
         hlffi_value* arr = hlffi_array_new(vm, &hlt_i32, 3);
@@ -1,7 +1,8 @@
 /**
  * Phase 7: Caching API Tests
  *
- * Tests the performance caching API for static method calls.
+ * Tests the performance caching API for static and instance method calls,
+ * cached field access and bulk field sync.
  */
 
 #include "hlffi.h"
@@ -41,6 +42,11 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    /* Before the entry point creates any instance: the field cache builds
+     * FastCacheEntity's runtime object without its method table */
+    hlffi_cached_field* early_field = hlffi_cache_field(vm, "FastCacheEntity", "x");
+    hlffi_cached_call* early_update = hlffi_cache_instance_method(vm, "FastCacheEntity", "update");
+
     if (hlffi_call_entry(vm) != HLFFI_OK) {
         fprintf(stderr, "Failed to call entry point: %s\n", hlffi_get_error(vm));
         hlffi_destroy(vm);
@@ -284,6 +290,182 @@ int main(int argc, char** argv) {
         }
     }
 
+    /* Test 8: Override cached by subclass name before any instance existed */
+    printf("\nTest 8: Instance method cached before any instance\n");
+    {
+        if (early_field && early_update) {
+            hlffi_value* fast = hlffi_new(vm, "FastCacheEntity", 0, NULL);
+            hlffi_value* dt = hlffi_value_float(vm, 1.0);
+            hlffi_value* result = hlffi_call_cached_method(early_update, fast, 1, &dt);
+            hlffi_value_free(result);
+
+            /* FastCacheEntity.update: x += speed(2) * dt * 2; the parent's gives 2 */
+            double x = hlffi_cached_field_get_float(early_field, fast, -1.0);
+            if (x == 4.0) {
+                TEST_PASS("Cached update dispatched to the FastCacheEntity override");
+            } else {
+                TEST_FAIL("Cached update did not run the override");
+                printf("    Expected x: 4.0, Got: %f\n", x);
+            }
+
+            hlffi_value_free(dt);
+            hlffi_value_free(fast);
+        } else {
+            TEST_FAIL("Failed to cache FastCacheEntity.update before the entry point");
+            printf("    Error: %s\n", hlffi_get_error(vm));
+        }
+        hlffi_cached_call_free(early_update);
+        hlffi_cached_field_free(early_field);
+    }
+
+    /* Test 9: Cached field inherited from the parent class */
+    printf("\nTest 9: Cached inherited field\n");
+    {
+        hlffi_cached_field* base_x = hlffi_cache_field(vm, "CacheEntity", "x");
+        hlffi_cached_field* fast_x = hlffi_cache_field(vm, "FastCacheEntity", "x");
+        hlffi_cached_field* base_speed = hlffi_cache_field(vm, "CacheEntity", "speed");
+        hlffi_value* fast = hlffi_new(vm, "FastCacheEntity", 0, NULL);
+
+        if (base_x && fast_x && base_speed && fast) {
+            /* Subclass layouts extend the parent's: one offset for both handles */
+            bool set = hlffi_cached_field_set_float(base_x, fast, 3.5);
+            double via_fast = hlffi_cached_field_get_float(fast_x, fast, -1.0);
+            hlffi_value* reflected = hlffi_get_field(fast, "x");
+            double via_reflection = hlffi_value_as_float(reflected, -1.0);
+            hlffi_value_free(reflected);
+
+            if (set && via_fast == 3.5 && via_reflection == 3.5) {
+                TEST_PASS("Parent and subclass handles agree on the inherited x");
+            } else {
+                TEST_FAIL("Inherited field offset mismatch");
+                printf("    Via subclass handle: %f, via hlffi_get_field: %f\n", via_fast, via_reflection);
+            }
+
+            /* FastCacheEntity's constructor sets speed = 2.0 */
+            double speed = hlffi_cached_field_get_float(base_speed, fast, -1.0);
+            if (speed == 2.0) {
+                TEST_PASS("Parent handle reads the subclass instance's speed");
+            } else {
+                TEST_FAIL("Parent handle read the wrong speed");
+                printf("    Expected: 2.0, Got: %f\n", speed);
+            }
+        } else {
+            TEST_FAIL("Failed to cache fields or create FastCacheEntity");
+            printf("    Error: %s\n", hlffi_get_error(vm));
+        }
+
+        hlffi_value_free(fast);
+        hlffi_cached_field_free(base_speed);
+        hlffi_cached_field_free(fast_x);
+        hlffi_cached_field_free(base_x);
+    }
+
+    /* Test 10: Cached field on a receiver of the wrong class */
+    printf("\nTest 10: Cached field type-mismatched receiver\n");
+    {
+        hlffi_cached_field* fast_x = hlffi_cache_field(vm, "FastCacheEntity", "x");
+        hlffi_value* base = hlffi_new(vm, "CacheEntity", 0, NULL);
+
+        if (fast_x && base) {
+            /* A CacheEntity is not a FastCacheEntity */
+            double x = hlffi_cached_field_get_float(fast_x, base, -1.0);
+            bool set = hlffi_cached_field_set_float(fast_x, base, 9.0);
+            hlffi_value* reflected = hlffi_get_field(base, "x");
+            double untouched = hlffi_value_as_float(reflected, -1.0);
+            hlffi_value_free(reflected);
+
+            if (x == -1.0 && !set && untouched == 0.0) {
+                TEST_PASS("Parent instance rejected by the subclass handle");
+            } else {
+                TEST_FAIL("Subclass handle accepted a parent instance");
+                printf("    get: %f, set: %d, x after: %f\n", x, set, untouched);
+            }
+
+            /* Wrong accessor type for a Float field */
+            hlffi_value* fast = hlffi_new(vm, "FastCacheEntity", 0, NULL);
+            if (hlffi_cached_field_get_int(fast_x, fast, -7) == -7 &&
+                !hlffi_cached_field_set_int(fast_x, fast, 1)) {
+                TEST_PASS("Int accessors rejected on a Float field");
+            } else {
+                TEST_FAIL("Int accessor used on a Float field");
+            }
+            hlffi_value_free(fast);
+        } else {
+            TEST_FAIL("Failed to cache field or create CacheEntity");
+            printf("    Error: %s\n", hlffi_get_error(vm));
+        }
+
+        hlffi_value_free(base);
+        hlffi_cached_field_free(fast_x);
+    }
+
+    /* Test 11: Gather/scatter round trip over an object array */
+    printf("\nTest 11: Bulk field gather/scatter\n");
+    {
+        hlffi_cached_field* px = hlffi_cache_field(vm, "CacheEntity", "x");
+        hlffi_cached_field* speed = hlffi_cache_field(vm, "CacheEntity", "speed");
+
+        /* 8 entities alternating CacheEntity / FastCacheEntity, x = index */
+        hlffi_value* n_arg = hlffi_value_int(vm, 8);
+        hlffi_value* made = hlffi_call_static(vm, "CacheTest", "makeEntities", 1, &n_arg);
+        hlffi_value_free(made);
+        hlffi_value_free(n_arg);
+        hlffi_value* entities = hlffi_get_static_field(vm, "CacheTest", "entities");
+
+        double xs[8] = {0};
+        float speeds[8] = {0};
+        hlffi_field_column cols[] = {
+            { px, HLFFI_TYPE_F64, xs },
+            { speed, HLFFI_TYPE_F32, speeds },
+        };
+
+        int n = (px && speed && entities) ? hlffi_array_gather_fields(vm, entities, cols, 2, 8) : -1;
+        bool ok = n == 8;
+        for (int i = 0; ok && i < 8; i++) {
+            ok = xs[i] == i && speeds[i] == ((i & 1) ? 2.0f : 1.0f);
+        }
+        if (ok) {
+            TEST_PASS("Gathered x (Float -> double) and speed (Float -> float)");
+        } else {
+            TEST_FAIL("Gathered values wrong");
+            printf("    Count: %d, Error: %s\n", n, hlffi_get_error(vm));
+        }
+
+        /* Write back x only, then read everything again */
+        for (int i = 0; i < 8; i++) xs[i] = i * 10 + 0.5;
+        int written = hlffi_array_scatter_fields(vm, entities, cols, 1, -1);
+
+        double xs2[8] = {0};
+        float speeds2[8] = {0};
+        hlffi_field_column cols2[] = {
+            { px, HLFFI_TYPE_F64, xs2 },
+            { speed, HLFFI_TYPE_F32, speeds2 },
+        };
+        ok = written == 8 && hlffi_array_gather_fields(vm, entities, cols2, 2, -1) == 8;
+        for (int i = 0; ok && i < 8; i++) {
+            ok = xs2[i] == i * 10 + 0.5 && speeds2[i] == speeds[i];
+        }
+        if (ok) {
+            TEST_PASS("Scattered x round-tripped, speed untouched");
+        } else {
+            TEST_FAIL("Scatter/gather round trip mismatch");
+            printf("    Written: %d, Error: %s\n", written, hlffi_get_error(vm));
+        }
+
+        /* max_count truncates the copy */
+        double first[3] = {0};
+        hlffi_field_column x_only[] = { { px, HLFFI_TYPE_F64, first } };
+        if (entities && hlffi_array_gather_fields(vm, entities, x_only, 1, 3) == 3 && first[2] == 20.5) {
+            TEST_PASS("Gather limited by max_count");
+        } else {
+            TEST_FAIL("Gather ignored max_count");
+        }
+
+        hlffi_value_free(entities);
+        hlffi_cached_field_free(speed);
+        hlffi_cached_field_free(px);
+    }
+
     /* Cleanup */
     hlffi_destroy(vm);
 
@@ -89,6 +89,15 @@ static hlffi_value* callback_on_compute(hlffi_vm* vm, int argc, hlffi_value** ar
     return hlffi_value_int(vm, result);
 }
 
+/* Typed callback: (Int, Float, Bool)->Float, arguments arrive unboxed */
+static hlffi_value* callback_on_impact(hlffi_vm* vm, int argc, hlffi_value** argv) {
+    if (argc != 3) return NULL;
+    int id = hlffi_value_as_int(argv[0], 0);
+    double force = hlffi_value_as_float(argv[1], 0.0);
+    bool solid = hlffi_value_as_bool(argv[2], false);
+    return hlffi_value_float(vm, solid ? force * id : -force);
+}
+
 /* Helper: Call void static method */
 static void call_void(hlffi_vm* vm, const char* class_name, const char* method_name, int argc, hlffi_value** argv) {
     hlffi_value* result = hlffi_call_static(vm, class_name, method_name, argc, argv);
@@ -335,11 +344,11 @@ int main(int argc, char** argv) {
 
     /* Test 10: Reject invalid arity */
     {
-        bool ok = hlffi_register_callback(vm, "invalid", callback_on_notify, 10);
+        bool ok = hlffi_register_callback(vm, "invalid", callback_on_notify, HLFFI_MAX_CALLBACK_ARGS + 1);
         if (!ok) {
-            TEST_PASS("Reject invalid callback arity (>4)");
+            TEST_PASS("Reject invalid callback arity (>HLFFI_MAX_CALLBACK_ARGS)");
         } else {
-            TEST_FAIL("Reject invalid callback arity (>4)");
+            TEST_FAIL("Reject invalid callback arity (>HLFFI_MAX_CALLBACK_ARGS)");
         }
     }
 
@@ -399,6 +408,85 @@ int main(int argc, char** argv) {
         }
     }
 
+    /* Test 15: Typed callback with Int/Float/Bool arguments */
+    {
+        hlffi_arg_type args[] = {HLFFI_ARG_INT, HLFFI_ARG_FLOAT, HLFFI_ARG_BOOL};
+        bool ok = hlffi_register_callback_typed(vm, "onImpact", callback_on_impact, 3, args, HLFFI_ARG_FLOAT);
+        hlffi_value* cb = ok ? hlffi_get_callback(vm, "onImpact") : NULL;
+        if (cb && hlffi_set_static_field(vm, "Callbacks", "onImpact", cb) == HLFFI_OK) {
+            hlffi_value* id = hlffi_value_int(vm, 4);
+            hlffi_value* force = hlffi_value_float(vm, 2.5);
+            hlffi_value* solid = hlffi_value_bool(vm, true);
+            hlffi_value* call_args[] = {id, force, solid};
+            hlffi_value* ret = hlffi_call_static(vm, "Callbacks", "callImpactCallback", 3, call_args);
+            double result = hlffi_value_as_float(ret, 0.0);
+
+            if (result == 10.0) {
+                TEST_PASS("Invoke typed (Int,Float,Bool)->Float callback from Haxe");
+            } else {
+                TEST_FAIL("Invoke typed (Int,Float,Bool)->Float callback from Haxe");
+                printf("  Expected: 10.0, Got: %f\n", result);
+            }
+
+            if (ret) hlffi_value_free(ret);
+            hlffi_value_free(solid);
+            hlffi_value_free(force);
+            hlffi_value_free(id);
+        } else {
+            TEST_FAIL("Invoke typed (Int,Float,Bool)->Float callback from Haxe");
+            printf("  Error: %s\n", hlffi_get_error(vm));
+        }
+        if (cb) hlffi_value_free(cb);
+    }
+
+    /* Test 16: Reject typed callback with a Void argument */
+    {
+        hlffi_arg_type args[] = {HLFFI_ARG_INT, HLFFI_ARG_VOID};
+        bool ok = hlffi_register_callback_typed(vm, "invalidTyped", callback_on_impact, 2, args, HLFFI_ARG_INT);
+        if (!ok) {
+            TEST_PASS("Reject typed callback with Void argument");
+        } else {
+            TEST_FAIL("Reject typed callback with Void argument");
+        }
+    }
+
+    /* Test 17: Registry grows past the old 64-entry limit, entries survive removals */
+    {
+        char name[32];
+        int registered = 0;
+        for (int i = 0; i < 500; i++) {
+            snprintf(name, sizeof(name), "binding_%d", i);
+            if (hlffi_register_callback(vm, name, callback_on_notify, 0)) registered++;
+        }
+        int removed = 0;
+        for (int i = 0; i < 500; i += 2) {
+            snprintf(name, sizeof(name), "binding_%d", i);
+            if (hlffi_unregister_callback(vm, name)) removed++;
+        }
+        int found = 0;
+        for (int i = 0; i < 500; i++) {
+            snprintf(name, sizeof(name), "binding_%d", i);
+            hlffi_value* cb = hlffi_get_callback(vm, name);
+            if (cb) {
+                found++;
+                hlffi_value_free(cb);
+            }
+        }
+
+        /* The onNotify closure set in Haxe earlier must still dispatch */
+        int before = call_int(vm, "Callbacks", "getNotifyCount", 0, NULL);
+        call_void(vm, "Callbacks", "callNotifyCallback", 0, NULL);
+        int after = call_int(vm, "Callbacks", "getNotifyCount", 0, NULL);
+
+        if (registered == 500 && removed == 250 && found == 250 && after == before + 1) {
+            TEST_PASS("Register 500 callbacks, unregister half");
+        } else {
+            TEST_FAIL("Register 500 callbacks, unregister half");
+            printf("  registered=%d removed=%d found=%d notify %d -> %d\n",
+                   registered, removed, found, before, after);
+        }
+    }
+
     /* Cleanup */
     hlffi_destroy(vm);
 
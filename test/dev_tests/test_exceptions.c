@@ -371,6 +371,33 @@ int main(int argc, char** argv) {
         }
     }
 
+    /* Test 14: Stack trace is the one captured at throw time */
+    {
+        char first[2048] = "";
+        hlffi_value* result = NULL;
+        const char* error = NULL;
+
+        hlffi_try_call_static(vm, "Exceptions", "nestedThrow", 0, NULL, &result, NULL);
+        const char* stack = hlffi_get_exception_stack(vm);
+        if (stack) {
+            strncpy(first, stack, sizeof(first) - 1);
+        }
+
+        /* Throw again, then let Haxe throw and catch before the trace is read */
+        hlffi_try_call_static(vm, "Exceptions", "nestedThrow", 0, NULL, &result, NULL);
+        hlffi_value* caught = hlffi_call_static(vm, "Exceptions", "throwAndCatch", 0, NULL);
+        if (caught) hlffi_value_free(caught);
+        stack = hlffi_get_exception_stack(vm);
+        error = hlffi_get_exception_message(vm);
+
+        if (stack && strcmp(stack, first) == 0 && error && strstr(error, "nested")) {
+            TEST_PASS("Stack trace and message survive a later caught exception");
+        } else {
+            TEST_FAIL("Stack trace and message survive a later caught exception");
+            printf("  Message: %s\n", error ? error : "(null)");
+        }
+    }
+
     /* Cleanup */
     hlffi_destroy(vm);
 
@@ -6,6 +6,10 @@
  * 2. Call getValue() - expect 100
  * 3. Reload with hot_reload_v2.hl (getValue returns 200)
  * 4. Call getValue() - expect 200
+ * 5. Same through handles cached before the reload (no re-caching)
+ * 6. Async reload back to hot_reload_v1.hl, applied by hlffi_update()
+ * 7. THREADED mode: async reload to hot_reload_v2.hl, applied by the VM
+ *    thread's message loop with no hlffi_update() calls
  *
  * This demonstrates in-place code patching without VM restart.
  */
@@ -14,6 +18,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -30,6 +35,15 @@ static void on_reload(hlffi_vm* vm, bool changed, void* userdata) {
            name, changed ? "true" : "false");
 }
 
+/* Runs on the VM thread (THREADED mode) */
+static void* get_value_on_vm_thread(hlffi_vm* vm, void* userdata) {
+    (void)userdata;
+    hlffi_value* result = hlffi_call_static(vm, "HotReload", "getValue", 0, NULL);
+    intptr_t value = hlffi_value_as_int(result, -1);
+    hlffi_value_free(result);
+    return (void*)value;
+}
+
 /* Helper to call static method and get int result */
 static int call_and_get_int(hlffi_vm* vm, const char* cls, const char* method, int fallback) {
     hlffi_value* result = hlffi_call_static(vm, cls, method, 0, NULL);
@@ -97,6 +111,15 @@ int main(int argc, char** argv) {
     int version1 = call_and_get_int(vm, "HotReload", "getVersion", -1);
     printf("getVersion() = %d (expected 1)\n", version1);
 
+    /* Cache getValue() before the reload: handles must follow the patch */
+    hlffi_cached_call* cached_get = hlffi_cache_static_method(vm, "HotReload", "getValue");
+    hlffi_cached_call* typed_get = hlffi_cache_static_method_typed(vm, "HotReload", "getValue", ":i");
+    if (!cached_get || !typed_get) {
+        fprintf(stderr, "Failed to cache getValue(): %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
     /* Test counter persistence */
     int counter = call_and_get_int(vm, "HotReload", "increment", -1);
     printf("increment() = %d\n", counter);
@@ -126,10 +149,70 @@ int main(int argc, char** argv) {
     int version2 = call_and_get_int(vm, "HotReload", "getVersion", -1);
     printf("getVersion() = %d (expected 2)\n", version2);
 
+    /* Handles cached before the reload re-resolve on first use */
+    hlffi_value* cached_result = hlffi_call_cached(cached_get, 0, NULL);
+    int cached_value = hlffi_value_as_int(cached_result, -1);
+    hlffi_value_free(cached_result);
+    printf("cached getValue() = %d (expected 200)\n", cached_value);
+
+    hlffi_native_value typed_ret;
+    int typed_value = hlffi_call_cached_typed(typed_get, NULL, &typed_ret) ? typed_ret.i : -1;
+    printf("typed cached getValue() = %d (expected 200)\n", typed_value);
+
+    hlffi_cached_call_free(typed_get);
+    hlffi_cached_call_free(cached_get);
+
     /* Check if counter persisted across reload */
     int counter_after = call_and_get_int(vm, "HotReload", "getCounter", -1);
     printf("getCounter() = %d (after reload - may be 0 or 2 depending on HL behavior)\n", counter_after);
 
+    /* Async reload back to V1: parsed off-thread, patched in hlffi_update() */
+    printf("\n--- Async reload with V1 ---\n");
+    int value3 = -1;
+    hlffi_reload_stats stats = {0};
+    if (hlffi_reload_module_async(vm, "test/hot_reload_v1.hl") == HLFFI_OK) {
+        for (int t = 0; t < 5000 && hlffi_reload_pending(vm); t++) {
+            hlffi_update(vm, 0.001f);
+            sleep_ms(1);
+        }
+        value3 = call_and_get_int(vm, "HotReload", "getValue", -1);
+        hlffi_get_reload_stats(vm, &stats);
+    } else {
+        fprintf(stderr, "Failed to start async reload: %s\n", hlffi_get_error(vm));
+    }
+    printf("getValue() = %d (expected 100)\n", value3);
+    printf("read %.2f ms, parse %.2f ms, patch %.2f ms, stall %.2f ms (async=%d)\n",
+           stats.read_ms, stats.parse_ms, stats.patch_ms, stats.stall_ms, stats.async);
+
+    /* THREADED mode: the worker never posts, the VM thread picks it up */
+    printf("\n--- Async reload with V2 (THREADED mode) ---\n");
+    int value4 = -1;
+    bool threaded_cleared = false;
+    hlffi_reload_stats threaded_stats = {0};
+    hlffi_set_integration_mode(vm, HLFFI_MODE_THREADED);
+    if (hlffi_thread_start(vm) == HLFFI_OK) {
+        /* Let the VM thread go idle: nothing but the publish may wake it */
+        sleep_ms(50);
+        if (hlffi_reload_module_async(vm, "test/hot_reload_v2.hl") == HLFFI_OK) {
+            for (int t = 0; t < 5000 && hlffi_reload_pending(vm); t++) {
+                sleep_ms(1);
+            }
+            /* Checked before any message is sent to the VM thread */
+            threaded_cleared = !hlffi_reload_pending(vm);
+            void* result = NULL;
+            if (hlffi_thread_call_sync_result(vm, get_value_on_vm_thread, NULL, &result) == HLFFI_OK) {
+                value4 = (int)(intptr_t)result;
+            }
+            hlffi_get_reload_stats(vm, &threaded_stats);
+        } else {
+            fprintf(stderr, "Failed to start async reload: %s\n", hlffi_get_error(vm));
+        }
+        hlffi_thread_stop(vm);
+    } else {
+        fprintf(stderr, "Failed to start VM thread: %s\n", hlffi_get_error(vm));
+    }
+    printf("getValue() = %d (expected 200)\n", value4);
+
     /* Cleanup */
     printf("\nCleaning up...\n");
     hlffi_destroy(vm);
@@ -143,11 +226,18 @@ int main(int argc, char** argv) {
      * The counter also persists across reload (stays at 2).
      */
     bool code_changed = (value1 == 100 && value2 == 200);
+    bool caches_followed = (cached_value == 200 && typed_value == 200);
     bool statics_persisted = (version2 == 1 && counter_after == 2);  /* NOT reset! */
+    bool async_applied = (value3 == 100 && stats.async && stats.success);
+    bool threaded_applied = (threaded_cleared && value4 == 200 &&
+                             threaded_stats.async && threaded_stats.success);
 
-    if (code_changed) {
+    if (code_changed && caches_followed && async_applied && threaded_applied) {
         printf("SUCCESS: Hot reload worked correctly!\n");
         printf("  - getValue() changed from 100 to 200\n");
+        printf("  - Handles cached before the reload returned 200\n");
+        printf("  - Async reload back to V1 applied by hlffi_update()\n");
+        printf("  - THREADED async reload applied by the VM thread\n");
         printf("  - Static variables persisted (version=%d, counter=%d)\n", version2, counter_after);
         printf("\nNote: Static var initializers are NOT re-executed during hot reload.\n");
         printf("Only function code is patched. This is expected HashLink behavior.\n");
@@ -156,6 +246,10 @@ int main(int argc, char** argv) {
         printf("FAILURE: Hot reload did not work as expected\n");
         printf("  - V1 getValue() = %d (expected 100)\n", value1);
         printf("  - V2 getValue() = %d (expected 200)\n", value2);
+        printf("  - Cached/typed getValue() = %d/%d (expected 200)\n", cached_value, typed_value);
+        printf("  - Async getValue() = %d (expected 100)\n", value3);
+        printf("  - THREADED async applied without messages: %s\n", threaded_cleared ? "yes" : "no");
+        printf("  - THREADED async getValue() = %d (expected 200)\n", value4);
         return 1;
     }
 }
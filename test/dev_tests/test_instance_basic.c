@@ -155,11 +155,65 @@ int main(int argc, char** argv) {
     hlffi_value_free(player);
     TEST_PASS("Player freed successfully");
 
+    /* ========== TEST 11: Handle lifecycle ========== */
+    printf("\n--- Test 11: Hold a Player through a handle ---\n");
+
+    hlffi_value* hero = hlffi_new(vm, "Player", 0, NULL);
+    if (!hero) TEST_ERROR(vm);
+    hlffi_handle h = hlffi_handle_acquire(vm, hero);
+    hlffi_value_free(hero);  /* The table keeps the object alive */
+    if (h == HLFFI_HANDLE_NULL) TEST_ERROR(vm);
+
+    hlffi_value_storage slot;
+    hlffi_value* view = hlffi_handle_get_at(vm, h, &slot);
+    hlffi_value* hero_hp = hlffi_call_method(view, "getHealth", 0, NULL);
+    int hero_health = hlffi_value_as_int(hero_hp, -1);
+    hlffi_value_free(hero_hp);
+    if (hero_health != 100) TEST_FAIL("Expected getHealth() = 100 through handle view");
+
+    if (!hlffi_handle_release(vm, h)) TEST_ERROR(vm);
+    if (hlffi_handle_is_valid(vm, h) || hlffi_handle_get(vm, h)) {
+        TEST_FAIL("Released handle should be stale");
+    }
+    if (hlffi_handle_release(vm, h)) TEST_FAIL("Double release should fail");
+
+    /* The slot is reused with a new generation: the old handle stays stale */
+    hlffi_value* other = hlffi_new(vm, "Player", 0, NULL);
+    hlffi_handle h2 = hlffi_handle_acquire(vm, other);
+    hlffi_value_free(other);
+    if (h2 == h || hlffi_handle_is_valid(vm, h) || !hlffi_handle_is_valid(vm, h2)) {
+        TEST_FAIL("Reused slot must not revive the stale handle");
+    }
+    hlffi_handle_release(vm, h2);
+    TEST_PASS("Handle acquire/get/release with stale detection");
+
+    /* ========== TEST 12: Handle table growth ========== */
+    printf("\n--- Test 12: 1000 handles, release half ---\n");
+
+    static hlffi_handle handles[1000];
+    for (int i = 0; i < 1000; i++) {
+        hlffi_value* v = hlffi_value_int(vm, i);
+        handles[i] = hlffi_handle_acquire(vm, v);
+        hlffi_value_free(v);
+        if (handles[i] == HLFFI_HANDLE_NULL) TEST_ERROR(vm);
+    }
+    for (int i = 1; i < 1000; i += 2) hlffi_handle_release(vm, handles[i]);
+    if (hlffi_handle_count(vm) != 500) TEST_FAIL("Expected 500 live handles");
+    for (int i = 0; i < 1000; i += 2) {
+        hlffi_value* v = hlffi_handle_get(vm, handles[i]);
+        int n = hlffi_value_as_int(v, -1);
+        hlffi_value_free(v);
+        if (n != i) TEST_FAIL("Handle returned the wrong value after growth");
+    }
+    for (int i = 0; i < 1000; i += 2) hlffi_handle_release(vm, handles[i]);
+    if (hlffi_handle_count(vm) != 0) TEST_FAIL("Expected no live handles");
+    TEST_PASS("Table grows, keeps values and recycles slots");
+
     /* Cleanup */
     printf("\n--- Cleanup ---\n");
     hlffi_destroy(vm);
     TEST_PASS("VM destroyed");
 
-    printf("\n=== All 10 tests passed! ===\n");
+    printf("\n=== All 12 tests passed! ===\n");
     return 0;
 }
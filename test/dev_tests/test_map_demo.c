@@ -1,12 +1,54 @@
 /**
  * Map Demo - Shows Map operations from C
+ *
+ * Tests 1-3 demonstrate basic access; tests 4-10 assert:
+ * - native IntMap / StringMap / ObjectMap access, checked from Haxe
+ * - the reflective fallback (EnumValueMap)
+ * - hlffi_map_new + size + clear, typed *_int / *_float accessors
+ * - hlffi_map_foreach early stop, hlffi_map_export, hlffi_map_set_many
  */
 
 #include "include/hlffi.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <hl.h>
 
+#define TEST_PASS(msg) printf("✓ %s\n", msg)
+#define TEST_FAIL(msg) do { printf("✗ FAIL: %s\n", msg); return 1; } while(0)
+
+/* Call MapTest.<method> and return its Int result (-999 on failure) */
+static int call_int(hlffi_vm* vm, const char* method, int argc, hlffi_value** args) {
+    hlffi_value* result = hlffi_call_static(vm, "MapTest", method, argc, args);
+    int value = hlffi_value_as_int(result, -999);
+    hlffi_value_free(result);
+    return value;
+}
+
+/* MapTest.<method>(map, key:Int) */
+static int call_int_key(hlffi_vm* vm, const char* method, hlffi_value* map, int key) {
+    hlffi_value* k = hlffi_value_int(vm, key);
+    hlffi_value* args[] = {map, k};
+    int value = call_int(vm, method, 2, args);
+    hlffi_value_free(k);
+    return value;
+}
+
+/* Stops after `limit` entries, summing Int values */
+typedef struct {
+    int calls;
+    int limit;
+    int sum;
+} foreach_state;
+
+static bool count_entries(hlffi_value* key, hlffi_value* value, void* userdata) {
+    (void)key;
+    foreach_state* st = (foreach_state*)userdata;
+    st->calls++;
+    st->sum += hlffi_value_as_int(value, 0);
+    return st->limit <= 0 || st->calls < st->limit;
+}
+
 int main(int argc, char** argv) {
     printf("==========================================\n");
     printf("  Phase 5: Map Demo - Haxe ↔ C\n");
@@ -131,12 +173,272 @@ int main(int argc, char** argv) {
         hlffi_value_free(map3);
     }
 
+    /* ========== TEST 4: C-created IntMap, read from Haxe ========== */
+    printf("\n--- Test 4: hlffi_map_new IntMap + size/clear ---\n");
+    {
+        hlffi_value* map = hlffi_map_new(vm, &hlt_i32, &hlt_bytes);
+        if (!map) TEST_FAIL("hlffi_map_new(Int, String) returned NULL");
+        if (hlffi_map_size(map) != 0) TEST_FAIL("New map should be empty");
+
+        hlffi_value* one = hlffi_value_string(vm, "one");
+        hlffi_value* two = hlffi_value_string(vm, "two");
+        if (!hlffi_map_int_set(vm, map, 1, one) || !hlffi_map_int_set(vm, map, 2, two)) {
+            TEST_FAIL("hlffi_map_int_set failed");
+        }
+        hlffi_value_free(one);
+        hlffi_value_free(two);
+        if (hlffi_map_size(map) != 2) TEST_FAIL("Size should be 2 after two sets");
+
+        /* Haxe calls String.length on the C-written value */
+        if (call_int_key(vm, "intMapValueLength", map, 2) != 3) {
+            TEST_FAIL("Haxe did not read C-written String value \"two\"");
+        }
+        hlffi_value* args[] = {map};
+        hlffi_value* listed = hlffi_call_static(vm, "MapTest", "processIntMap", 1, args);
+        char* text = hlffi_value_as_string(listed);
+        bool listed_ok = text && strstr(text, "1=one") && strstr(text, "2=two");
+        free(text);
+        hlffi_value_free(listed);
+        if (!listed_ok) TEST_FAIL("Haxe iteration did not see C-written entries");
+
+        hlffi_value* key = hlffi_value_int(vm, 1);
+        hlffi_value* got = hlffi_map_get(vm, map, key);
+        char* str = hlffi_value_as_string(got);
+        bool get_ok = str && strcmp(str, "one") == 0;
+        free(str);
+        hlffi_value_free(got);
+        if (!get_ok) TEST_FAIL("hlffi_map_get(1) should be \"one\"");
+        if (!hlffi_map_remove(vm, map, key)) TEST_FAIL("hlffi_map_remove(1) should succeed");
+        if (hlffi_map_exists(vm, map, key)) TEST_FAIL("Key 1 still exists after remove");
+        hlffi_value_free(key);
+
+        if (!hlffi_map_clear(map) || hlffi_map_size(map) != 0) TEST_FAIL("hlffi_map_clear did not empty the map");
+        hlffi_value_free(map);
+        TEST_PASS("IntMap created in C: set/get/remove/size/clear, visible from Haxe");
+    }
+
+    /* ========== TEST 5: Typed accessors and fallbacks ========== */
+    printf("\n--- Test 5: *_int / *_float typed variants ---\n");
+    {
+        hlffi_value* smap = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+        hlffi_value* imap = hlffi_map_new(vm, &hlt_i32, &hlt_f64);
+        if (!smap || !imap) TEST_FAIL("hlffi_map_new failed");
+
+        hlffi_map_str_set_int(vm, smap, "hp", 42);
+        hlffi_map_str_set_float(vm, smap, "speed", 2.5);
+        hlffi_map_int_set_int(vm, imap, 7, 70);
+        hlffi_map_int_set_float(vm, imap, 8, 0.25);
+
+        if (hlffi_map_str_get_int(vm, smap, "hp", -1) != 42) TEST_FAIL("str_get_int(hp) != 42");
+        if (hlffi_map_str_get_float(vm, smap, "speed", -1.0) != 2.5) TEST_FAIL("str_get_float(speed) != 2.5");
+        if (hlffi_map_int_get_int(vm, imap, 7, -1) != 70) TEST_FAIL("int_get_int(7) != 70");
+        if (hlffi_map_int_get_float(vm, imap, 8, -1.0) != 0.25) TEST_FAIL("int_get_float(8) != 0.25");
+
+        if (hlffi_map_str_get_int(vm, smap, "missing", -7) != -7) TEST_FAIL("Missing String key should give fallback (int)");
+        if (hlffi_map_str_get_float(vm, smap, "missing", -7.5) != -7.5) TEST_FAIL("Missing String key should give fallback (float)");
+        if (hlffi_map_int_get_int(vm, imap, 99, -7) != -7) TEST_FAIL("Missing Int key should give fallback (int)");
+        if (hlffi_map_int_get_float(vm, imap, 99, -7.5) != -7.5) TEST_FAIL("Missing Int key should give fallback (float)");
+
+        if (!hlffi_map_str_exists(vm, smap, "hp") || hlffi_map_str_exists(vm, smap, "missing")) {
+            TEST_FAIL("hlffi_map_str_exists wrong");
+        }
+        if (!hlffi_map_str_remove(vm, smap, "hp") || hlffi_map_str_remove(vm, smap, "hp")) {
+            TEST_FAIL("hlffi_map_str_remove should succeed once");
+        }
+        if (hlffi_map_int_set_int(vm, smap, 1, 1)) TEST_FAIL("int accessor on a StringMap should fail");
+
+        hlffi_value_free(smap);
+        hlffi_value_free(imap);
+        TEST_PASS("Typed get/set round-trip, missing keys return the fallback");
+    }
+
+    /* ========== TEST 6: Haxe StringMap written from C ========== */
+    printf("\n--- Test 6: Haxe StringMap, native writes ---\n");
+    {
+        hlffi_value* map = hlffi_call_static(vm, "MapTest", "createStringMap", 0, NULL);
+        if (!map) TEST_FAIL("createStringMap failed");
+        hlffi_map_str_set_int(vm, map, "d", 40);
+        if (hlffi_map_size(map) != 4) TEST_FAIL("Size should be 4 (a, b, c, d)");
+
+        hlffi_value* args[] = {map};
+        if (call_int(vm, "sumStringMap", 1, args) != 100) TEST_FAIL("Haxe sum should be 10+20+30+40");
+        hlffi_value_free(map);
+        TEST_PASS("Haxe sees a C-written StringMap entry");
+    }
+
+    /* ========== TEST 7: ObjectMap ========== */
+    printf("\n--- Test 7: ObjectMap (native) ---\n");
+    {
+        hlffi_value* map = hlffi_call_static(vm, "MapTest", "createObjectMap", 0, NULL);
+        hlffi_value* idx0 = hlffi_value_int(vm, 0);
+        hlffi_value* idx2 = hlffi_value_int(vm, 2);
+        hlffi_value* key0 = hlffi_call_static(vm, "MapTest", "objectKey", 1, &idx0);
+        hlffi_value* key2 = hlffi_call_static(vm, "MapTest", "objectKey", 1, &idx2);
+        if (!map || !key0 || !key2) TEST_FAIL("ObjectMap setup failed");
+
+        hlffi_value* got = hlffi_map_get(vm, map, key0);
+        if (hlffi_value_as_int(got, -1) != 100) TEST_FAIL("ObjectMap get(key0) != 100");
+        hlffi_value_free(got);
+
+        hlffi_value* v = hlffi_value_int(vm, 300);
+        if (!hlffi_map_set(vm, map, key2, v)) TEST_FAIL("ObjectMap set(key2) failed");
+        hlffi_value_free(v);
+
+        hlffi_value* args[] = {map, key2};
+        if (call_int(vm, "getObjectMapValue", 2, args) != 300) TEST_FAIL("Haxe did not see ObjectMap write");
+        if (hlffi_map_size(map) != 3) TEST_FAIL("ObjectMap size should be 3");
+
+        hlffi_value* empty = hlffi_map_new(vm, NULL, NULL);
+        if (!empty || hlffi_map_size(empty) != 0) TEST_FAIL("hlffi_map_new(NULL) should give an empty ObjectMap");
+
+        hlffi_value_free(empty);
+        hlffi_value_free(key2);
+        hlffi_value_free(key0);
+        hlffi_value_free(idx2);
+        hlffi_value_free(idx0);
+        hlffi_value_free(map);
+        TEST_PASS("ObjectMap get/set by identity, visible from Haxe");
+    }
+
+    /* ========== TEST 8: Reflective fallback (EnumValueMap) ========== */
+    printf("\n--- Test 8: EnumValueMap (reflective fallback) ---\n");
+    {
+        hlffi_value* map = hlffi_call_static(vm, "MapTest", "createEnumMap", 0, NULL);
+        hlffi_value* idx0 = hlffi_value_int(vm, 0);
+        hlffi_value* idx2 = hlffi_value_int(vm, 2);
+        hlffi_value* red = hlffi_call_static(vm, "MapTest", "colorKey", 1, &idx0);
+        hlffi_value* blue = hlffi_call_static(vm, "MapTest", "colorKey", 1, &idx2);
+        if (!map || !red || !blue) TEST_FAIL("EnumValueMap setup failed");
+
+        hlffi_value* got = hlffi_map_get(vm, map, red);
+        if (hlffi_value_as_int(got, -1) != 1) TEST_FAIL("EnumValueMap get(Red) != 1");
+        hlffi_value_free(got);
+        if (hlffi_map_exists(vm, map, blue)) TEST_FAIL("Blue should not exist yet");
+
+        hlffi_value* v = hlffi_value_int(vm, 3);
+        if (!hlffi_map_set(vm, map, blue, v)) TEST_FAIL("EnumValueMap set(Blue) failed");
+        hlffi_value_free(v);
+        hlffi_value* args[] = {map, blue};
+        if (call_int(vm, "getEnumMapValue", 2, args) != 3) TEST_FAIL("Haxe did not see EnumValueMap write");
+
+        if (!hlffi_map_remove(vm, map, blue)) TEST_FAIL("EnumValueMap remove(Blue) failed");
+        if (hlffi_map_size(map) != -1) TEST_FAIL("hlffi_map_size should be -1 for a non-native map");
+        if (!hlffi_map_clear(map) || hlffi_map_exists(vm, map, red)) TEST_FAIL("EnumValueMap clear failed");
+
+        hlffi_value_free(blue);
+        hlffi_value_free(red);
+        hlffi_value_free(idx2);
+        hlffi_value_free(idx0);
+        hlffi_value_free(map);
+        TEST_PASS("Reflective get/set/exists/remove/clear on EnumValueMap");
+    }
+
+    /* ========== TEST 9: hlffi_map_set_many ========== */
+    printf("\n--- Test 9: hlffi_map_set_many (I32, BYTES, DYN keys) ---\n");
+    {
+        static const int32_t ids[] = {1, 2, 3, 4, 5};
+        static const int32_t tens[] = {10, 20, 30, 40, 50};
+        hlffi_value* imap = hlffi_map_new(vm, &hlt_i32, &hlt_i32);
+        if (!hlffi_map_set_many(vm, imap, HLFFI_TYPE_I32, ids, HLFFI_TYPE_I32, tens, 5)) {
+            TEST_FAIL("set_many with I32 keys failed");
+        }
+        hlffi_value* iargs[] = {imap};
+        if (hlffi_map_size(imap) != 5 || call_int(vm, "sumIntMap", 1, iargs) != 150) {
+            TEST_FAIL("I32 set_many: Haxe sum should be 150");
+        }
+
+        static const char* names[] = {"sword", "shield"};
+        static const int32_t prices[] = {150, 90};
+        hlffi_value* smap = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+        if (!hlffi_map_set_many(vm, smap, HLFFI_TYPE_BYTES, names, HLFFI_TYPE_I32, prices, 2)) {
+            TEST_FAIL("set_many with BYTES keys failed");
+        }
+        hlffi_value* sargs[] = {smap};
+        if (hlffi_map_str_get_int(vm, smap, "shield", -1) != 90 || call_int(vm, "sumStringMap", 1, sargs) != 240) {
+            TEST_FAIL("BYTES set_many: wrong values");
+        }
+        if (hlffi_map_set_many(vm, smap, HLFFI_TYPE_I32, ids, HLFFI_TYPE_I32, tens, 1)) {
+            TEST_FAIL("I32 keys on a StringMap should be rejected");
+        }
+
+        hlffi_value* omap = hlffi_map_new(vm, NULL, NULL);
+        hlffi_value* idx[2] = { hlffi_value_int(vm, 0), hlffi_value_int(vm, 1) };
+        hlffi_value* okeys[2] = {
+            hlffi_call_static(vm, "MapTest", "objectKey", 1, &idx[0]),
+            hlffi_call_static(vm, "MapTest", "objectKey", 1, &idx[1])
+        };
+        hlffi_value* ovals[2] = { hlffi_value_int(vm, 7), hlffi_value_int(vm, 8) };
+        if (!hlffi_map_set_many(vm, omap, HLFFI_TYPE_DYN, okeys, HLFFI_TYPE_DYN, ovals, 2)) {
+            TEST_FAIL("set_many with DYN keys failed");
+        }
+        hlffi_value* oargs[] = {omap, okeys[1]};
+        if (hlffi_map_size(omap) != 2 || call_int(vm, "getObjectMapValue", 2, oargs) != 8) {
+            TEST_FAIL("DYN set_many: Haxe should read 8 for key 1");
+        }
+        for (int i = 0; i < 2; i++) {
+            hlffi_value_free(ovals[i]);
+            hlffi_value_free(okeys[i]);
+            hlffi_value_free(idx[i]);
+        }
+        hlffi_value_free(omap);
+        hlffi_value_free(smap);
+
+        /* ========== TEST 10: foreach / export on the I32 map ========== */
+        printf("\n--- Test 10: hlffi_map_foreach / hlffi_map_export ---\n");
+
+        foreach_state all = {0, 0, 0};
+        if (hlffi_map_foreach(vm, imap, count_entries, &all) != 5 || all.sum != 150) {
+            TEST_FAIL("foreach should visit 5 entries summing 150");
+        }
+        foreach_state stop = {0, 2, 0};
+        if (hlffi_map_foreach(vm, imap, count_entries, &stop) != 2 || stop.calls != 2) {
+            TEST_FAIL("foreach should stop after the callback returns false");
+        }
+
+        if (hlffi_map_export(vm, imap, HLFFI_TYPE_I32, NULL, HLFFI_TYPE_VOID, NULL, 0) != 5) {
+            TEST_FAIL("Size-only export should return 5");
+        }
+        int32_t keys[5], values[5];
+        if (hlffi_map_export(vm, imap, HLFFI_TYPE_I32, keys, HLFFI_TYPE_I32, values, 5) != 5) {
+            TEST_FAIL("Export should copy 5 entries");
+        }
+        for (int i = 0; i < 5; i++) {
+            if (values[i] != keys[i] * 10) TEST_FAIL("Exported key/value pairs do not match");
+        }
+        if (hlffi_map_export(vm, imap, HLFFI_TYPE_I32, keys, HLFFI_TYPE_VOID, NULL, 3) != 3) {
+            TEST_FAIL("Export should stop at cap");
+        }
+
+        hlffi_value* shop = hlffi_map_new(vm, &hlt_bytes, &hlt_i32);
+        hlffi_map_set_many(vm, shop, HLFFI_TYPE_BYTES, names, HLFFI_TYPE_I32, prices, 2);
+        char* skeys[2] = {NULL, NULL};
+        double svals[2];
+        if (hlffi_map_export(vm, shop, HLFFI_TYPE_BYTES, skeys, HLFFI_TYPE_F64, svals, 2) != 2) {
+            TEST_FAIL("String key export should copy 2 entries");
+        }
+        for (int i = 0; i < 2; i++) {
+            bool ok = skeys[i] &&
+                      ((strcmp(skeys[i], "sword") == 0 && svals[i] == 150.0) ||
+                       (strcmp(skeys[i], "shield") == 0 && svals[i] == 90.0));
+            free(skeys[i]);
+            if (!ok) TEST_FAIL("Exported String keys/values wrong");
+        }
+        if (hlffi_map_export(vm, shop, HLFFI_TYPE_I32, keys, HLFFI_TYPE_VOID, NULL, 2) != -1) {
+            TEST_FAIL("I32 key export from a StringMap should fail");
+        }
+
+        hlffi_value_free(shop);
+        hlffi_value_free(imap);
+        TEST_PASS("set_many (I32/BYTES/DYN), foreach early stop, export + size query");
+    }
+
     /* Cleanup */
     hlffi_destroy(vm);
 
     printf("\n==========================================\n");
     printf("  ✓ Map tests complete!\n");
     printf("  ✓ Demonstrated get, set, exists\n");
+    printf("  ✓ Native, reflective, bulk and typed access asserted\n");
     printf("  ✓ Showed C ↔ Haxe map interop\n");
     printf("==========================================\n");
 
@@ -0,0 +1,130 @@
+/**
+ * Hot Reload File Watch Test
+ *
+ * Tests automatic change detection in hlffi_check_reload():
+ * 1. Copy hot_reload_v1.hl to a scratch file and load it
+ * 2. Idle polling does not reload
+ * 3. Overwrite the scratch file with hot_reload_v2.hl in two halves
+ *    (a slow writer) - the reload waits for the writes to settle
+ * 4. getValue() returns 200 afterwards
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define sleep_ms(ms) Sleep(ms)
+#else
+#include <unistd.h>
+#define sleep_ms(ms) usleep((ms) * 1000)
+#endif
+
+#define TEST_PASS(msg) printf("✓ %s\n", msg)
+#define TEST_FAIL(msg) do { printf("✗ FAIL: %s\n", msg); return 1; } while(0)
+
+#define SCRATCH_FILE "test/hot_reload_watch.hl"
+
+static int reloads = 0;
+
+static void on_reload(hlffi_vm* vm, bool changed, void* userdata) {
+    (void)vm; (void)changed; (void)userdata;
+    reloads++;
+}
+
+static unsigned char* read_file(const char* path, long* size) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char* data = (unsigned char*)malloc(*size);
+    if (data && fread(data, 1, *size, f) != (size_t)*size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static bool write_file(const char* path, const unsigned char* data, long size) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, 1, size, f) == (size_t)size;
+    fclose(f);
+    return ok;
+}
+
+static int get_value(hlffi_vm* vm) {
+    hlffi_value* result = hlffi_call_static(vm, "HotReload", "getValue", 0, NULL);
+    int value = hlffi_value_as_int(result, -1);
+    hlffi_value_free(result);
+    return value;
+}
+
+/* Call hlffi_check_reload like a game loop (~1ms frames) for up to ms */
+static bool poll_for(hlffi_vm* vm, int ms) {
+    for (int t = 0; t < ms; t++) {
+        if (hlffi_check_reload(vm)) return true;
+        sleep_ms(1);
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    printf("=== Hot Reload File Watch Test ===\n\n");
+
+    long v1_size = 0, v2_size = 0;
+    unsigned char* v1 = read_file("test/hot_reload_v1.hl", &v1_size);
+    unsigned char* v2 = read_file("test/hot_reload_v2.hl", &v2_size);
+    if (!v1 || !v2) TEST_FAIL("Need test/hot_reload_v1.hl and test/hot_reload_v2.hl");
+    if (!write_file(SCRATCH_FILE, v1, v1_size)) TEST_FAIL("Cannot write scratch file");
+
+    hlffi_vm* vm = hlffi_create();
+    hlffi_enable_hot_reload(vm, true);
+    hlffi_set_reload_callback(vm, on_reload, NULL);
+    if (hlffi_init(vm, 0, NULL) != HLFFI_OK ||
+        hlffi_load_file(vm, SCRATCH_FILE) != HLFFI_OK ||
+        hlffi_call_entry(vm) != HLFFI_OK) {
+        printf("✗ Error: %s\n", hlffi_get_error(vm));
+        return 1;
+    }
+    hlffi_set_reload_timing(vm, 10, 150);
+    printf("Watch backend: %s\n", hlffi_get_reload_fd(vm) >= 0 ? "inotify" : "stat polling");
+
+    /* ========== TEST 1: No change, no reload ========== */
+    printf("\n--- Test 1: Idle polling ---\n");
+    if (get_value(vm) != 100) TEST_FAIL("Expected getValue() = 100 from v1");
+    if (poll_for(vm, 200) || reloads != 0) TEST_FAIL("Reloaded without a change");
+    TEST_PASS("No reload while the file is unchanged");
+
+    /* ========== TEST 2: Slow writer is debounced ========== */
+    printf("\n--- Test 2: Change written in two halves ---\n");
+    FILE* f = fopen(SCRATCH_FILE, "wb");
+    if (!f) TEST_FAIL("Cannot rewrite scratch file");
+    fwrite(v2, 1, v2_size / 2, f);
+    fflush(f);
+    if (poll_for(vm, 50)) TEST_FAIL("Reloaded a partially written file");
+    fwrite(v2 + v2_size / 2, 1, v2_size - v2_size / 2, f);
+    fclose(f);
+    TEST_PASS("No reload while the file was being written");
+
+    /* ========== TEST 3: Settled change reloads once ========== */
+    printf("\n--- Test 3: Reload after the writes settle ---\n");
+    if (!poll_for(vm, 2000)) TEST_FAIL("Change was not detected");
+    if (reloads != 1) TEST_FAIL("Expected exactly one reload");
+    if (get_value(vm) != 200) TEST_FAIL("Expected getValue() = 200 from v2");
+    if (poll_for(vm, 200)) TEST_FAIL("Reloaded again without a change");
+    TEST_PASS("Reloaded once, getValue() = 200");
+
+    hlffi_destroy(vm);
+    remove(SCRATCH_FILE);
+    free(v1);
+    free(v2);
+
+    printf("\n=== All 3 tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,229 @@
+/**
+ * Value Scope Tests
+ *
+ * Tests hlffi_scope_begin/hlffi_scope_end:
+ * 1. hlffi_value_free() is a no-op on scope values
+ * 2. Slots are reused after hlffi_scope_end()
+ * 3. Nested scopes release only their own values
+ * 4. hlffi_new() objects survive hl_gc_major() inside a scope
+ * 5. Values created after the outermost end are ordinary values
+ * 6. Another thread cannot open a scope on a VM while one is open
+ */
+
+#include "hlffi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hl.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#define TEST_PASS(msg) printf("  ✓ %s\n", msg)
+#define TEST_FAIL(msg) do { printf("  ✗ %s\n", msg); failures++; } while(0)
+
+#define ENTITIES 1000
+
+#ifndef _WIN32
+/* Runs on a second thread while the main thread holds a scope */
+static void* begin_on_other_thread(void* param) {
+    hlffi_vm* vm = (hlffi_vm*)param;
+    hlffi_scope scope;
+    bool opened = hlffi_scope_begin(vm, &scope);
+    if (opened) hlffi_scope_end(vm, &scope);
+    return opened ? (void*)1 : NULL;
+}
+#endif
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <cachetest.hl>\n", argv[0]);
+        return 1;
+    }
+
+    printf("=== Value Scope Tests ===\n\n");
+
+    int failures = 0;
+
+    hlffi_vm* vm = hlffi_create();
+    if (!vm) {
+        fprintf(stderr, "Failed to create VM\n");
+        return 1;
+    }
+
+    if (hlffi_init(vm, 0, NULL) != HLFFI_OK) {
+        fprintf(stderr, "Failed to initialize VM\n");
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    if (hlffi_load_file(vm, argv[1]) != HLFFI_OK) {
+        fprintf(stderr, "Failed to load bytecode: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    if (hlffi_call_entry(vm) != HLFFI_OK) {
+        fprintf(stderr, "Failed to call entry point: %s\n", hlffi_get_error(vm));
+        hlffi_destroy(vm);
+        return 1;
+    }
+
+    /* Test 1: hlffi_value_free is a no-op */
+    printf("Test 1: hlffi_value_free on a scope value\n");
+    {
+        hlffi_scope scope;
+        if (hlffi_scope_begin(vm, &scope)) {
+            hlffi_value* a = hlffi_value_int(vm, 42);
+            hlffi_value_free(a);
+            hlffi_value* b = hlffi_value_int(vm, 43);
+
+            /* A real free would let b reuse a's wrapper */
+            if (a && b && a != b && hlffi_value_as_int(a, -1) == 42 &&
+                hlffi_value_as_int(b, -1) == 43) {
+                TEST_PASS("Freed scope value stays valid until scope end");
+            } else {
+                TEST_FAIL("hlffi_value_free released a scope value");
+            }
+            hlffi_scope_end(vm, &scope);
+        } else {
+            TEST_FAIL("hlffi_scope_begin failed");
+            printf("    Error: %s\n", hlffi_get_error(vm));
+        }
+    }
+
+    /* Test 2: Slot reuse after end */
+    printf("\nTest 2: Slot reuse after hlffi_scope_end\n");
+    {
+        hlffi_scope scope;
+        hlffi_scope_begin(vm, &scope);
+        hlffi_value* first = hlffi_value_int(vm, 1);
+        hlffi_scope_end(vm, &scope);
+
+        hlffi_scope_begin(vm, &scope);
+        hlffi_value* second = hlffi_value_int(vm, 2);
+        bool reused = first && first == second && hlffi_value_as_int(second, -1) == 2;
+        hlffi_scope_end(vm, &scope);
+
+        if (reused) {
+            TEST_PASS("Next scope hands out the released slot");
+        } else {
+            TEST_FAIL("Slot not reused after scope end");
+        }
+    }
+
+    /* Test 3: Nesting */
+    printf("\nTest 3: Nested scopes\n");
+    {
+        hlffi_scope outer, inner;
+        hlffi_scope_begin(vm, &outer);
+        hlffi_value* kept = hlffi_value_int(vm, 7);
+
+        hlffi_scope_begin(vm, &inner);
+        hlffi_value* temp = hlffi_value_int(vm, 8);
+        hlffi_scope_end(vm, &inner);
+
+        /* The inner end released temp's slot only */
+        hlffi_value* next = hlffi_value_int(vm, 9);
+        bool ok = temp && next == temp && next != kept &&
+                  hlffi_value_as_int(kept, -1) == 7 && hlffi_value_as_int(next, -1) == 9;
+        hlffi_scope_end(vm, &outer);
+
+        if (ok) {
+            TEST_PASS("Inner end keeps the outer scope's values");
+        } else {
+            TEST_FAIL("Inner end released outer values");
+        }
+    }
+
+    /* Test 4: Objects survive a major GC inside a scope */
+    printf("\nTest 4: hlffi_new objects across hl_gc_major()\n");
+    {
+        static hlffi_value* entities[ENTITIES];
+        hlffi_scope scope;
+        hlffi_scope_begin(vm, &scope);
+
+        /* Several blocks' worth of wrappers (object + boxed float each) */
+        for (int i = 0; i < ENTITIES; i++) {
+            entities[i] = hlffi_new(vm, "CacheEntity", 0, NULL);
+            hlffi_value* x = hlffi_value_float(vm, i * 0.5);
+            hlffi_set_field(entities[i], "x", x);
+        }
+
+        hl_gc_major();
+        hl_gc_major();
+
+        bool ok = true;
+        for (int i = 0; ok && i < ENTITIES; i++) {
+            hlffi_value* x = hlffi_get_field(entities[i], "x");
+            ok = x && hlffi_value_as_float(x, -1.0) == i * 0.5;
+        }
+        hlffi_scope_end(vm, &scope);
+
+        if (ok) {
+            TEST_PASS("Scope objects and their fields survived a major GC");
+        } else {
+            TEST_FAIL("Scope object lost across hl_gc_major()");
+        }
+    }
+
+    /* Test 5: Outside any scope values are ordinary */
+    printf("\nTest 5: Values after the outermost end\n");
+    {
+        hlffi_scope scope;
+        hlffi_scope_begin(vm, &scope);
+        hlffi_value* scoped = hlffi_value_int(vm, 1);
+        hlffi_scope_end(vm, &scope);
+
+        hlffi_value* plain = hlffi_value_int(vm, 5);
+        hlffi_value* plain2 = hlffi_value_int(vm, 6);
+        if (plain && plain != scoped && plain2 != scoped &&
+            hlffi_value_as_int(plain, -1) == 5 && hlffi_value_as_int(plain2, -1) == 6) {
+            TEST_PASS("Values outside a scope do not come from the arena");
+        } else {
+            TEST_FAIL("Value allocated from the arena outside a scope");
+        }
+        hlffi_value_free(plain2);
+        hlffi_value_free(plain);
+    }
+
+#ifndef _WIN32
+    /* Test 6: Scope ownership is per thread */
+    printf("\nTest 6: Scope opened on another thread\n");
+    {
+        hlffi_scope scope;
+        hlffi_scope_begin(vm, &scope);
+
+        pthread_t thread;
+        void* opened = (void*)1;
+        if (pthread_create(&thread, NULL, begin_on_other_thread, vm) == 0) {
+            pthread_join(thread, &opened);
+        }
+        hlffi_scope_end(vm, &scope);
+
+        /* Once closed, any thread may open one */
+        void* reopened = NULL;
+        if (pthread_create(&thread, NULL, begin_on_other_thread, vm) == 0) {
+            pthread_join(thread, &reopened);
+        }
+
+        if (!opened && reopened) {
+            TEST_PASS("Second thread rejected while the scope is open");
+        } else {
+            TEST_FAIL("Scope ownership not enforced per thread");
+        }
+    }
+#endif
+
+    hlffi_destroy(vm);
+
+    printf("\n=== Test Summary ===\n");
+    if (failures == 0) {
+        printf("✓ All tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ %d test(s) failed\n", failures);
+        return 1;
+    }
+}
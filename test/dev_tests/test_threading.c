@@ -15,12 +15,26 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <stdint.h>
+
 #ifdef _WIN32
     #include <windows.h>
+    #include <process.h>
     #define sleep_ms(ms) Sleep(ms)
+    typedef HANDLE test_thread;
+    #define THREAD_FUNC(name) static unsigned __stdcall name(void* param)
+    #define THREAD_RETURN return 0
+    #define thread_create(t, fn, arg) ((*(t) = (HANDLE)_beginthreadex(NULL, 0, fn, arg, 0, NULL)) != 0)
+    #define thread_join(t) (WaitForSingleObject(t, INFINITE), CloseHandle(t))
 #else
     #include <unistd.h>
+    #include <pthread.h>
     #define sleep_ms(ms) usleep((ms) * 1000)
+    typedef pthread_t test_thread;
+    #define THREAD_FUNC(name) static void* name(void* param)
+    #define THREAD_RETURN return NULL
+    #define thread_create(t, fn, arg) (pthread_create(t, NULL, fn, arg) == 0)
+    #define thread_join(t) pthread_join(t, NULL)
 #endif
 
 /* Test result tracking */
@@ -68,6 +82,100 @@ static void async_completion_callback(hlffi_vm* vm, void* result, void* userdata
     fflush(stdout);
 }
 
+/* Runs on the VM thread: records the order messages were executed in */
+#define ORDER_PRODUCERS 4
+#define ORDER_PER_PRODUCER 250
+
+static int order_log[ORDER_PRODUCERS * ORDER_PER_PRODUCER + 16];
+static int order_count = 0;
+
+static void record_order(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    if (order_count < (int)(sizeof(order_log) / sizeof(order_log[0]))) {
+        order_log[order_count] = (int)(intptr_t)userdata;
+    }
+    order_count++;
+}
+
+static void noop_callback(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    (void)userdata;
+}
+
+static void* double_value(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    return (void*)((intptr_t)userdata * 2);
+}
+
+static void* expensive_op_result(hlffi_vm* vm, void* userdata) {
+    hlffi_value* arg = hlffi_value_int(vm, (int)(intptr_t)userdata);
+    hlffi_value* args[] = { arg };
+    hlffi_value* result = hlffi_call_static(vm, "ThreadingSimple", "expensiveOperation", 1, args);
+    intptr_t value = hlffi_value_as_int(result, -1);
+    hlffi_value_free(result);
+    hlffi_value_free(arg);
+    return (void*)value;
+}
+
+static void* cache_expensive_op(hlffi_vm* vm, void* userdata) {
+    (void)userdata;
+    return hlffi_cache_static_method_typed(vm, "ThreadingSimple", "expensiveOperation", "i:i");
+}
+
+static void free_cached_call(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    hlffi_cached_call_free((hlffi_cached_call*)userdata);
+}
+
+/* Holds the VM thread inside a message until released */
+static volatile int blocker_started = 0;
+static volatile int blocker_release = 0;
+
+static void block_vm_thread(hlffi_vm* vm, void* userdata) {
+    (void)vm;
+    (void)userdata;
+    blocker_started = 1;
+    while (!blocker_release) {
+        sleep_ms(1);
+    }
+}
+
+static int start_blocker(hlffi_vm* vm) {
+    blocker_started = 0;
+    blocker_release = 0;
+    if (hlffi_thread_call_async(vm, block_vm_thread, NULL, NULL) != HLFFI_OK) {
+        return 0;
+    }
+    for (int t = 0; t < 1000 && !blocker_started; t++) {
+        sleep_ms(1);
+    }
+    return blocker_started;
+}
+
+typedef struct {
+    hlffi_vm* vm;
+    int producer;
+    int failures;
+} order_producer;
+
+THREAD_FUNC(produce_ordered) {
+    order_producer* p = (order_producer*)param;
+    for (int seq = 0; seq < ORDER_PER_PRODUCER; seq++) {
+        intptr_t tag = p->producer * 1000 + seq;
+        if (hlffi_thread_call_async(p->vm, record_order, NULL, (void*)tag) != HLFFI_OK) {
+            p->failures++;
+        }
+    }
+    THREAD_RETURN;
+}
+
+static hlffi_error_code stop_result;
+
+THREAD_FUNC(stop_vm_thread) {
+    stop_result = hlffi_thread_stop((hlffi_vm*)param);
+    THREAD_RETURN;
+}
+
 /* ========== TEST 1: Thread Start/Stop ========== */
 int test_thread_start_stop(hlffi_vm* vm) {
     TEST("Thread Start/Stop");
@@ -170,7 +278,133 @@ int test_expensive_ops(hlffi_vm* vm) {
     return 1;
 }
 
-/* ========== TEST 7: Final Stop ========== */
+/* ========== TEST 7: FIFO Order Across Producers ========== */
+int test_fifo_order(hlffi_vm* vm) {
+    TEST("FIFO Order Across Producers");
+
+    order_count = 0;
+    order_producer producers[ORDER_PRODUCERS];
+    test_thread threads[ORDER_PRODUCERS];
+
+    printf("  %d producers x %d async calls...\n", ORDER_PRODUCERS, ORDER_PER_PRODUCER); fflush(stdout);
+    for (int p = 0; p < ORDER_PRODUCERS; p++) {
+        producers[p] = (order_producer){ vm, p, 0 };
+        CHECK(thread_create(&threads[p], produce_ordered, &producers[p]), "Failed to start producer %d", p);
+    }
+    for (int p = 0; p < ORDER_PRODUCERS; p++) {
+        thread_join(threads[p]);
+        CHECK(producers[p].failures == 0, "Producer %d: %d calls rejected", p, producers[p].failures);
+    }
+
+    /* Queued after every producer's messages: runs last */
+    CHECK(hlffi_thread_call_sync(vm, noop_callback, NULL) == HLFFI_OK, "Barrier sync call failed");
+    CHECK(order_count == ORDER_PRODUCERS * ORDER_PER_PRODUCER,
+          "Expected %d messages, %d ran", ORDER_PRODUCERS * ORDER_PER_PRODUCER, order_count);
+
+    /* Each producer's messages ran in the order it posted them */
+    int next_seq[ORDER_PRODUCERS] = {0};
+    for (int i = 0; i < order_count; i++) {
+        int producer = order_log[i] / 1000;
+        int seq = order_log[i] % 1000;
+        CHECK(producer >= 0 && producer < ORDER_PRODUCERS, "Bad tag %d at %d", order_log[i], i);
+        CHECK(seq == next_seq[producer], "Producer %d: seq %d ran, expected %d", producer, seq, next_seq[producer]);
+        next_seq[producer]++;
+    }
+
+    PASS();
+    return 1;
+}
+
+/* ========== TEST 8: Sync Results ========== */
+int test_sync_results(hlffi_vm* vm) {
+    TEST("Sync Results");
+
+    void* result = NULL;
+    CHECK(hlffi_thread_call_sync_result(vm, double_value, (void*)(intptr_t)21, &result) == HLFFI_OK,
+          "Sync result call failed");
+    CHECK((intptr_t)result == 42, "Expected 42, got %d", (int)(intptr_t)result);
+
+    /* Result computed by Haxe on the VM thread: sum of i*i for i < 100 */
+    CHECK(hlffi_thread_call_sync_result(vm, expensive_op_result, (void*)(intptr_t)100, &result) == HLFFI_OK,
+          "Sync result call into Haxe failed");
+    CHECK((intptr_t)result == 328350, "Expected 328350, got %d", (int)(intptr_t)result);
+
+    PASS();
+    return 1;
+}
+
+/* ========== TEST 9: Batches With Per-Entry Results ========== */
+int test_batches(hlffi_vm* vm) {
+    TEST("Batches With Per-Entry Results");
+
+    hlffi_thread_call calls[16];
+    for (int i = 0; i < 16; i++) {
+        calls[i] = (hlffi_thread_call){ .func = double_value, .userdata = (void*)(intptr_t)i, .result = NULL };
+    }
+    CHECK(hlffi_thread_call_batch(vm, calls, 16) == HLFFI_OK, "Batch failed");
+    for (int i = 0; i < 16; i++) {
+        CHECK((intptr_t)calls[i].result == i * 2, "Entry %d: expected %d, got %d",
+              i, i * 2, (int)(intptr_t)calls[i].result);
+    }
+    CHECK(hlffi_thread_call_batch(vm, NULL, 0) == HLFFI_OK, "Empty batch failed");
+
+    /* Typed cached batch: handle created and freed on the VM thread */
+    void* handle = NULL;
+    CHECK(hlffi_thread_call_sync_result(vm, cache_expensive_op, NULL, &handle) == HLFFI_OK && handle,
+          "Failed to cache expensiveOperation");
+
+    hlffi_native_value args[8];
+    hlffi_thread_cached_call cached_calls[8];
+    for (int i = 0; i < 8; i++) {
+        args[i].i = i * 10;
+        cached_calls[i] = (hlffi_thread_cached_call){ .cached = (hlffi_cached_call*)handle, .args = &args[i] };
+    }
+    hlffi_error_code err = hlffi_thread_call_cached_batch(vm, cached_calls, 8);
+    hlffi_thread_call_sync(vm, free_cached_call, handle);
+    CHECK(err == HLFFI_OK, "Cached batch failed");
+
+    for (int i = 0; i < 8; i++) {
+        int n = i * 10;
+        int expected = n > 0 ? (n - 1) * n * (2 * n - 1) / 6 : 0;
+        CHECK(cached_calls[i].ok && cached_calls[i].ret.i == expected,
+              "Cached entry %d: expected %d, got %d (ok=%d)", i, expected, cached_calls[i].ret.i, cached_calls[i].ok);
+    }
+
+    PASS();
+    return 1;
+}
+
+/* ========== TEST 10: Queue Limit ========== */
+int test_queue_limit(hlffi_vm* vm) {
+    TEST("Queue Limit");
+
+    CHECK(start_blocker(vm), "VM thread did not pick up the blocking call");
+
+    /* The executing blocker counts as pending: 3 more fit under a limit of 4 */
+    hlffi_thread_set_queue_limit(vm, 4);
+    order_count = 0;
+    int accepted = 0;
+    hlffi_error_code err = HLFFI_OK;
+    for (int i = 0; i < 10 && err == HLFFI_OK; i++) {
+        err = hlffi_thread_call_async(vm, record_order, NULL, (void*)(intptr_t)i);
+        if (err == HLFFI_OK) accepted++;
+    }
+
+    blocker_release = 1;
+    hlffi_thread_set_queue_limit(vm, 0);
+
+    CHECK(err == HLFFI_ERROR_QUEUE_FULL, "Expected HLFFI_ERROR_QUEUE_FULL, got %d", err);
+    CHECK(accepted == 3, "Expected 3 accepted calls, got %d", accepted);
+
+    CHECK(hlffi_thread_call_sync(vm, noop_callback, NULL) == HLFFI_OK, "Barrier sync call failed");
+    CHECK(order_count == 3, "Expected the 3 accepted calls to run, %d ran", order_count);
+    CHECK(hlffi_thread_call_async(vm, noop_callback, NULL, NULL) == HLFFI_OK, "Call rejected after lifting the limit");
+
+    PASS();
+    return 1;
+}
+
+/* ========== TEST 11: Final Stop ========== */
 int test_final_stop(hlffi_vm* vm) {
     TEST("Final Thread Stop");
 
@@ -182,6 +416,48 @@ int test_final_stop(hlffi_vm* vm) {
     return 1;
 }
 
+/* ========== TEST 12: Stop Drains Queue, Cancels Later Calls ========== */
+int test_stop_cancellation(hlffi_vm* vm) {
+    TEST("Stop Drains Queue, Cancels Later Calls");
+
+    CHECK(hlffi_thread_start(vm) == HLFFI_OK, "Failed to restart thread: %s", hlffi_get_error(vm));
+    CHECK(start_blocker(vm), "VM thread did not pick up the blocking call");
+
+    /* Queued before the stop request: must still run */
+    order_count = 0;
+    for (int i = 0; i < 5; i++) {
+        CHECK(hlffi_thread_call_async(vm, record_order, NULL, (void*)(intptr_t)i) == HLFFI_OK,
+              "Async call %d failed", i);
+    }
+
+    test_thread stopper;
+    CHECK(thread_create(&stopper, stop_vm_thread, vm), "Failed to start stopper thread");
+    sleep_ms(50);
+    blocker_release = 1;
+    thread_join(stopper);
+
+    CHECK(stop_result == HLFFI_OK, "hlffi_thread_stop failed");
+    CHECK(!hlffi_thread_is_running(vm), "Thread still running after stop");
+    CHECK(order_count == 5, "Expected 5 queued calls to run before exit, %d ran", order_count);
+
+    /* After the stop, nothing runs and nothing reports success */
+    void* result = (void*)1;
+    CHECK(hlffi_thread_call_sync(vm, record_order, NULL) == HLFFI_ERROR_THREAD_NOT_STARTED,
+          "Sync call after stop did not fail");
+    CHECK(hlffi_thread_call_sync_result(vm, double_value, (void*)(intptr_t)1, &result) == HLFFI_ERROR_THREAD_NOT_STARTED &&
+          result == NULL, "Sync result call after stop did not fail");
+
+    hlffi_thread_call call = { .func = double_value, .userdata = (void*)(intptr_t)1, .result = NULL };
+    CHECK(hlffi_thread_call_batch(vm, &call, 1) == HLFFI_ERROR_THREAD_NOT_STARTED && call.result == NULL,
+          "Batch after stop did not fail");
+    CHECK(hlffi_thread_call_async(vm, record_order, NULL, NULL) == HLFFI_ERROR_THREAD_NOT_STARTED,
+          "Async call after stop did not fail");
+    CHECK(order_count == 5, "A call ran after stop");
+
+    PASS();
+    return 1;
+}
+
 /* ========== MAIN ========== */
 int main(int argc, char** argv) {
     if (argc < 2) {
@@ -229,7 +505,12 @@ int main(int argc, char** argv) {
     test_async_calls(vm);
     test_concurrent_calls(vm);
     test_expensive_ops(vm);
+    test_fifo_order(vm);
+    test_sync_results(vm);
+    test_batches(vm);
+    test_queue_limit(vm);
     test_final_stop(vm);
+    test_stop_cancellation(vm);
 
     /* Print summary */
     printf("\n============================================\n");